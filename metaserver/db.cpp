@@ -49,6 +49,10 @@
 static const char *dbfile = "metaserver.db";
 static sqlite3 *DB;
 
+static sqlite3_stmt *FindUserStatement;         /// Prepared statement for DBFindUser
+static sqlite3_stmt *AddUserStatement;          /// Prepared statement for DBAddUser
+static sqlite3_stmt *UpdateLoginDateStatement;  /// Prepared statement for DBUpdateLoginDate
+
 #define SQLCreatePlayersTable \
 	"CREATE TABLE players (" \
 	"username TEXT PRIMARY KEY," \
@@ -117,6 +121,44 @@ static int DBMaxIDCallback(void *password, int argc, char **argv, char **colname
 	return 0;
 }
 
+/**
+**  Prepare the statements used by the queries
+**
+**  @return  0 for success, non-zero for failure
+*/
+static int DBPrepareStatements(void)
+{
+	if (sqlite3_prepare_v2(DB, "SELECT password FROM players WHERE username = ?1;", -1, &FindUserStatement, NULL) != SQLITE_OK
+		|| sqlite3_prepare_v2(DB, "INSERT INTO players VALUES(?1, ?2, ?3, ?3);", -1, &AddUserStatement, NULL) != SQLITE_OK
+		|| sqlite3_prepare_v2(DB, "UPDATE players SET last_login_date = ?1 WHERE username = ?2;", -1, &UpdateLoginDateStatement, NULL) != SQLITE_OK) {
+		fprintf(stderr, "ERROR: sqlite3_prepare_v2 failed: %s\n", sqlite3_errmsg(DB));
+		return -1;
+	}
+
+	return 0;
+}
+
+/**
+**  Execute a prepared statement which returns no rows, and reset it
+**
+**  @param statement  Statement to execute
+**
+**  @return           0 for success, non-zero otherwise
+*/
+static int DBExecuteStatement(sqlite3_stmt *statement)
+{
+	const int result = sqlite3_step(statement);
+	sqlite3_reset(statement);
+	sqlite3_clear_bindings(statement);
+
+	if (result != SQLITE_DONE) {
+		fprintf(stderr, "SQL error: %s\n", sqlite3_errmsg(DB));
+		return -1;
+	}
+
+	return 0;
+}
+
 /**
 **  Initialize the database
 **
@@ -141,25 +183,23 @@ int DBInit(void)
 		return -1;
 	}
 
-	if (!doinit) {
-		return 0;
-	}
+	if (doinit) {
+		errmsg = NULL;
+		if (sqlite3_exec(DB, SQLCreateTables, NULL, NULL, &errmsg) != SQLITE_OK) {
+			fprintf(stderr, "SQL error: %s\n", errmsg);
+			sqlite3_free(errmsg);
+			return -1;
+		}
 
-	errmsg = NULL;
-	if (sqlite3_exec(DB, SQLCreateTables, NULL, NULL, &errmsg) != SQLITE_OK) {
-		fprintf(stderr, "SQL error: %s\n", errmsg);
-		sqlite3_free(errmsg);
-		return -1;
-	}
-
-	errmsg = NULL;
-	if (sqlite3_exec(DB, "SELECT MAX(id) FROM games;", DBMaxIDCallback, NULL, &errmsg) != SQLITE_OK) {
-		fprintf(stderr, "SQL error: %s\n", errmsg);
-		sqlite3_free(errmsg);
-		return -1;
+		errmsg = NULL;
+		if (sqlite3_exec(DB, "SELECT MAX(id) FROM games;", DBMaxIDCallback, NULL, &errmsg) != SQLITE_OK) {
+			fprintf(stderr, "SQL error: %s\n", errmsg);
+			sqlite3_free(errmsg);
+			return -1;
+		}
 	}
 
-	return 0;
+	return DBPrepareStatements();
 }
 
 /**
@@ -167,19 +207,12 @@ int DBInit(void)
 */
 void DBQuit(void)
 {
+	sqlite3_finalize(FindUserStatement);
+	sqlite3_finalize(AddUserStatement);
+	sqlite3_finalize(UpdateLoginDateStatement);
 	sqlite3_close(DB);
 }
 
-/**
-**  Find user callback
-*/
-static int DBFindUserCallback(void *password, int argc, char **argv, char **colname)
-{
-	Assert(argc == 1);
-	strcpy((char *)password, argv[0]);
-	return 0;
-}
-
 /**
 **  Find a user and return the password
 **
@@ -190,20 +223,22 @@ static int DBFindUserCallback(void *password, int argc, char **argv, char **coln
 */
 int DBFindUser(char *username, char *password)
 {
-	char buf[1024];
-	char *errmsg;
+	int result;
 
 	password[0] = '\0';
-	if (strchr(username, '\'')) {
-		return 0;
-	}
 
-	sprintf(buf, "SELECT password FROM players WHERE username = '%s';", username);
-	if (sqlite3_exec(DB, buf, DBFindUserCallback, password, &errmsg) != SQLITE_OK) {
-		fprintf(stderr, "SQL error: %s\n", errmsg);
-		sqlite3_free(errmsg);
-		return 0;
+	sqlite3_bind_text(FindUserStatement, 1, username, -1, SQLITE_STATIC);
+	result = sqlite3_step(FindUserStatement);
+	if (result == SQLITE_ROW) {
+		const char *stored_password = (const char *)sqlite3_column_text(FindUserStatement, 0);
+		if (stored_password) {
+			strcpy(password, stored_password);
+		}
+	} else if (result != SQLITE_DONE) {
+		fprintf(stderr, "SQL error: %s\n", sqlite3_errmsg(DB));
 	}
+	sqlite3_reset(FindUserStatement);
+	sqlite3_clear_bindings(FindUserStatement);
 
 	if (password[0]) {
 		return 1;
@@ -221,19 +256,10 @@ int DBFindUser(char *username, char *password)
 */
 int DBAddUser(char *username, char *password)
 {
-	char buf[1024];
-	int t;
-	char *errmsg;
-
-	t = (int)time(0);
-	sprintf(buf, "INSERT INTO players VALUES('%s', '%s', %d, %d);",
-		username, password, t, t);
-	if (sqlite3_exec(DB, buf, NULL, NULL, &errmsg) != SQLITE_OK) {
-		fprintf(stderr, "SQL error: %s\n", errmsg);
-		sqlite3_free(errmsg);
-		return -1;
-	}
-	return 0;
+	sqlite3_bind_text(AddUserStatement, 1, username, -1, SQLITE_STATIC);
+	sqlite3_bind_text(AddUserStatement, 2, password, -1, SQLITE_STATIC);
+	sqlite3_bind_int(AddUserStatement, 3, (int)time(0));
+	return DBExecuteStatement(AddUserStatement);
 }
 
 /**
@@ -245,17 +271,7 @@ int DBAddUser(char *username, char *password)
 */
 int DBUpdateLoginDate(char *username)
 {
-	char buf[1024];
-	int t;
-	char *errmsg;
-
-	t = (int)time(0);
-	sprintf(buf, "UPDATE players SET last_login_date = %d WHERE username = '%s'",
-		t, username);
-	if (sqlite3_exec(DB, buf, NULL, NULL, &errmsg) != SQLITE_OK) {
-		fprintf(stderr, "SQL error: %s\n", errmsg);
-		sqlite3_free(errmsg);
-		return -1;
-	}
-	return 0;
+	sqlite3_bind_int(UpdateLoginDateStatement, 1, (int)time(0));
+	sqlite3_bind_text(UpdateLoginDateStatement, 2, username, -1, SQLITE_STATIC);
+	return DBExecuteStatement(UpdateLoginDateStatement);
 }
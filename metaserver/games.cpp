@@ -37,6 +37,11 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+
 #include "stratagus.h"
 #include "games.h"
 #include "netdriver.h"
@@ -45,13 +50,49 @@
 --  Variables
 ----------------------------------------------------------------------------*/
 
-static GameData *Games;
+typedef std::pair<std::string, std::string> GameType; /// Game name and version
+
+static std::map<int, GameData *> Games;                      /// All games, by ID
+static std::map<GameType, std::map<int, GameData *> > Lobby; /// Games which have not started, by game type and ID
 int GameID;
 
 /*----------------------------------------------------------------------------
 --  Functions
 ----------------------------------------------------------------------------*/
 
+/**
+**  Get the game type under which a game is listed in the lobby
+*/
+static GameType GetGameType(const GameData *game)
+{
+	return GameType(game->GameName, game->Version);
+}
+
+/**
+**  Remove a game from the lobby
+*/
+static void RemoveFromLobby(GameData *game)
+{
+	std::map<GameType, std::map<int, GameData *> >::iterator it = Lobby.find(GetGameType(game));
+
+	if (it == Lobby.end() || !it->second.count(game->ID)) {
+		// The host's game type changed after the game was created
+		for (it = Lobby.begin(); it != Lobby.end(); ++it) {
+			if (it->second.count(game->ID)) {
+				break;
+			}
+		}
+		if (it == Lobby.end()) {
+			return;
+		}
+	}
+
+	it->second.erase(game->ID);
+	if (it->second.empty()) {
+		Lobby.erase(it);
+	}
+}
+
 /**
 **  Create a game
 */
@@ -82,12 +123,8 @@ void CreateGame(Session *session, char *description, char *map,
 	game->GameName = session->UserData.GameName;
 	game->Version = session->UserData.Version;
 
-	if (Games) {
-		Games->Prev = game;
-	}
-	game->Next = Games;
-	game->Prev = NULL;
-	Games = game;
+	Games[game->ID] = game;
+	Lobby[GetGameType(game)][game->ID] = game;
 
 	session->Game = game;
 }
@@ -106,15 +143,8 @@ int CancelGame(Session *session)
 		return -1; // Not the host
 	}
 
-	if (game->Next) {
-		game->Next->Prev = game->Prev;
-	}
-	if (game->Prev) {
-		game->Prev->Next = game->Next;
-	}
-	if (Games == game) {
-		Games = game->Next;
-	}
+	RemoveFromLobby(game);
+	Games.erase(game->ID);
 
 	for (i = 0; i < game->NumSessions; ++i) {
 		game->Sessions[i]->Game = NULL;
@@ -134,6 +164,7 @@ int StartGame(Session *session)
 	}
 
 	session->Game->Started = 1;
+	RemoveFromLobby(session->Game);
 	return 0;
 }
 
@@ -148,16 +179,11 @@ int JoinGame(Session *session, int id, char *password)
 		return -1; // Already in a game
 	}
 
-	game = Games;
-	while (game) {
-		if (game->ID == id) {
-			break;
-		}
-		game = game->Next;
-	}
-	if (!game) {
+	std::map<int, GameData *>::iterator it = Games.find(id);
+	if (it == Games.end()) {
 		return -2; // ID not found
 	}
+	game = it->second;
 
 	if (game->Password[0]) {
 		if (!password || strcmp(game->Password, password)) {
@@ -211,28 +237,41 @@ int PartGame(Session *session)
 	return 0;
 }
 
-static int MatchGameType(Session *session, GameData *game)
-{
-	return (!*game->GameName || !strcmp(session->UserData.GameName, game->GameName)) &&
-		(!*game->Version || !strcmp(session->UserData.Version, game->Version));
-}
-
 /**
 **  List games
+**
+**  Only the lobby entries for the game types matching the session are
+**  looked at: games without a game name or version match any session.
 */
 void ListGames(Session *session)
 {
-	GameData *game;
+	std::set<GameType> game_types;
+	std::map<int, GameData *> games;
+	std::string reply;
 	char buf[1024];
 
-	game = Games;
-	while (game) {
-		if (!game->Started && MatchGameType(session, game)) {
-			sprintf(buf, "LISTGAMES %d \"%s\" \"%s\" %d %d %s %s\n",
-				game->ID, game->Description, game->Map,
-				game->OpenSlots, game->MaxSlots, game->IP, game->Port);
-			Send(session, buf);
+	game_types.insert(GameType(session->UserData.GameName, session->UserData.Version));
+	game_types.insert(GameType(session->UserData.GameName, ""));
+	game_types.insert(GameType("", session->UserData.Version));
+	game_types.insert(GameType("", ""));
+
+	for (std::set<GameType>::const_iterator it = game_types.begin(); it != game_types.end(); ++it) {
+		std::map<GameType, std::map<int, GameData *> >::const_iterator lobby_it = Lobby.find(*it);
+		if (lobby_it != Lobby.end()) {
+			games.insert(lobby_it->second.begin(), lobby_it->second.end());
 		}
-		game = game->Next;
+	}
+
+	// Newest games first, and sent together
+	for (std::map<int, GameData *>::reverse_iterator it = games.rbegin(); it != games.rend(); ++it) {
+		const GameData *game = it->second;
+		sprintf(buf, "LISTGAMES %d \"%s\" \"%s\" %d %d %s %s\n",
+			game->ID, game->Description, game->Map,
+			game->OpenSlots, game->MaxSlots, game->IP, game->Port);
+		reply += buf;
+	}
+
+	if (!reply.empty()) {
+		Send(session, reply.c_str());
 	}
 }
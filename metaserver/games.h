@@ -64,9 +64,6 @@ public:
 	int NumSessions;
 	int ID;
 	int Started;
-
-	GameData *Next;
-	GameData *Prev;
 };
 
 extern int GameID;
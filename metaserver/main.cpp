@@ -162,39 +162,31 @@ int getopt(int argc, char *const *argv, const char *opts)
 */
 static void MainLoop(void)
 {
-	Uint32 ticks[2];
 	int delay;
 	int done;
 
+	delay = Server.PollingDelay;
+	if (delay > 2000) {
+		delay = 2000;
+	}
+
 	//
 	// Start the transactions.
 	//
 	done = 0;
 	while (!done) {
-		ticks[0] = SDL_GetTicks();
-
 		//
 		// Update sessions and buffers.
 		//
 		UpdateSessions();
 		UpdateParser();
 
-		ticks[1] = SDL_GetTicks();
-
 		//
-		// Idle out the remainder of this loop.
+		// Sleep until there is socket activity, instead of for a fixed
+		// time; the polling delay only limits how long idlers can go
+		// unnoticed.
 		//
-		if ((int)(ticks[1] - ticks[0]) > Server.PollingDelay) {
-			delay = 0;
-		} else {
-			delay = Server.PollingDelay - (ticks[1] - ticks[0]);
-		}
-
-		if (delay > 2000) {
-			delay = 2000;
-		}
-
-		SDL_Delay(delay);
+		WaitForActivity(delay);
 	}
 
 }
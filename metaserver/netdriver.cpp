@@ -158,6 +158,9 @@ int ServerInit(int port)
 		return -6;
 	}
 
+	// Also watch the server socket, so that waiting for activity wakes up on new connections
+	Pool->Sockets->AddSocket(MasterSocket);
+
 	Pool->First = NULL;
 	Pool->Last = NULL;
 	Pool->Count = 0;
@@ -226,9 +229,10 @@ static void AcceptConnections()
 	while ((new_socket = NetAcceptTCP(MasterSocket, &host, &port)) != (Socket)-1) {
 		// Check if we're at MaxConnections
 		if (Pool->Count == Server.MaxConnections) {
+			//refuse all pending connections, as otherwise the listening socket would stay readable and keep waking up the main loop
 			NetSendTCP(new_socket, "Server Full\n", 12);
 			NetCloseTCP(new_socket);
-			break;
+			continue;
 		}
 
 		new_session = new Session;
@@ -289,13 +293,14 @@ static int ReadData()
 		Session *next = session->Next;
 		if (Pool->Sockets->HasDataToRead(session->Sock)) {
 			// socket ready
-			session->Idle = time(0);
 			int clen = strlen(session->Buffer);
 			result = NetRecvTCP(session->Sock, session->Buffer + clen,
-				sizeof(session->Buffer) - clen);
-			if (result < 0) {
+				sizeof(session->Buffer) - clen - 1);
+			if (result <= 0) {
+				//the connection was closed or failed, or the buffer is full without a complete line; the socket would otherwise stay readable and make the main loop spin
 				KillSession(session);
 			} else {
+				session->Idle = time(0);
 				session->Buffer[clen + result] = '\0';
 			}
 		}
@@ -305,6 +310,16 @@ static int ReadData()
 	return 0;
 }
 
+/**
+**  Wait until a connection arrives or a session has data to read
+**
+**  @param timeout  Maximum time to wait in milliseconds
+*/
+void WaitForActivity(int timeout)
+{
+	Pool->Sockets->Select(timeout);
+}
+
 /**
 **  Accepts new connections, receives data, manages buffers,
 */
@@ -145,6 +145,7 @@ extern void Send(Session *session, const char *msg);
 extern int ServerInit(int port);
 extern void ServerQuit(void);
 extern int UpdateSessions(void);
+extern void WaitForActivity(int timeout);
 
 //@}
 
@@ -129,7 +129,7 @@ void COrder_Die::Execute(CUnit &unit)
 	//Wyrmgus end
 	unit.ChooseVariation(corpse_type);
 	unit.Type = corpse_type;
-	unit.Stats = &corpse_type->Stats[unit.Player->get_index()];
+	unit.Stats = corpse_type->Stats.get_unit_stats_pointer(unit.Player->get_index());
 	//Wyrmgus start
 	unit.Variable = corpse_type->Stats[unit.Player->get_index()].Variables;
 	//Wyrmgus end
@@ -277,7 +277,7 @@ int TransformUnitIntoType(CUnit &unit, const wyrmgus::unit_type &newtype)
 	//Wyrmgus end
 	
 	unit.Type = &newtype;
-	unit.Stats = &unit.Type->Stats[player.get_index()];
+	unit.Stats = unit.Type->Stats.get_unit_stats_pointer(player.get_index());
 	
 	//Wyrmgus start
 	//change the civilization/faction upgrade markers for those of the new type
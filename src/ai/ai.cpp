@@ -426,22 +426,9 @@ static void AiCheckUnits()
 	for (int i = 0; i < n; ++i) {
 		const unsigned int t = AiPlayer->UnitTypeRequests[i].Type->Slot;
 		const int x = AiPlayer->UnitTypeRequests[i].Count;
-		const wyrmgus::unit_class *unit_class = AiPlayer->UnitTypeRequests[i].Type->get_unit_class();
 
 		// Add equivalent units
-		int e = AiPlayer->Player->GetUnitTypeAiActiveCount(AiPlayer->UnitTypeRequests[i].Type);
-		if (t < AiHelpers.Equiv.size()) {
-			for (unsigned int j = 0; j < AiHelpers.Equiv[t].size(); ++j) {
-				e += AiPlayer->Player->GetUnitTypeAiActiveCount(AiHelpers.Equiv[t][j]);
-			}
-		}
-		if (unit_class != nullptr) {
-			for (const wyrmgus::unit_type *class_unit_type : unit_class->get_unit_types()) {
-				if (class_unit_type != AiPlayer->UnitTypeRequests[i].Type) {
-					e += AiPlayer->Player->GetUnitTypeAiActiveCount(class_unit_type);
-				}
-			}
-		}
+		const int e = AiGetEquivalentUnitTypeAiActiveCount(*AiPlayer->Player, AiPlayer->UnitTypeRequests[i].Type);
 		const int requested = x - e - counter[t];
 		if (requested > 0) {  // Request it.
 			//Wyrmgus start
@@ -1662,7 +1649,7 @@ void AiEachSecond(CPlayer &player)
 	}
 
 	//  Advance script
-	AiExecuteScript();
+	AiPlayer->run_timed("script", AiExecuteScript);
 	
 	if (!player.is_alive()) {
 		return;
@@ -1671,27 +1658,33 @@ void AiEachSecond(CPlayer &player)
 	AiPlayer->NeededMask = 0;
 
 	//  Look if everything is fine.
-	AiCheckUnits();
+	AiPlayer->run_timed("check_units", AiCheckUnits);
 
-	AiPlayer->check_factions();
+	AiPlayer->run_timed("check_factions", []() {
+		AiPlayer->check_factions();
+	});
 
 	//  Handle the resource manager.
-	AiResourceManager();
+	AiPlayer->run_timed("resource_manager", AiResourceManager);
 
 	//  Handle the force manager.
-	AiForceManager();
+	AiPlayer->run_timed("force_manager", AiForceManager);
 
-	AiPlayer->check_site_transport_units();
+	AiPlayer->run_timed("site_transport_units", []() {
+		AiPlayer->check_site_transport_units();
+	});
 
 	//  Check for magic actions.
-	AiCheckMagic();
+	AiPlayer->run_timed("magic", AiCheckMagic);
 
 	// At most 1 explorer each 5 seconds
 	if (GameCycle > AiPlayer->LastExplorationGameCycle + 5 * CYCLES_PER_SECOND) {
-		AiSendExplorers();
+		AiPlayer->run_timed("explorers", AiSendExplorers);
 	}
 
-	AiPlayer->evaluate_diplomacy();
+	AiPlayer->run_timed("diplomacy", []() {
+		AiPlayer->evaluate_diplomacy();
+	});
 }
 
 /**
@@ -1713,11 +1706,11 @@ void AiEachHalfMinute(CPlayer &player)
 		AiPlayer->Scouting = false;
 	}
 	
-	AiCheckWorkers();
-	AiCheckUpgrades();
-	AiCheckBuildings();
+	AiPlayer->run_timed("check_workers", AiCheckWorkers);
+	AiPlayer->run_timed("check_upgrades", AiCheckUpgrades);
+	AiPlayer->run_timed("check_buildings", AiCheckBuildings);
 	
-	AiForceManagerEachHalfMinute();
+	AiPlayer->run_timed("force_manager_half_minute", AiForceManagerEachHalfMinute);
 }
 
 /**
@@ -1735,11 +1728,44 @@ void AiEachMinute(CPlayer &player)
 		return;
 	}
 
-	AiPlayer->check_settlement_construction();
-	AiPlayer->check_transporters();
-	AiCheckDockConstruction();
+	AiPlayer->run_timed("settlement_construction", []() {
+		AiPlayer->check_settlement_construction();
+	});
+	AiPlayer->run_timed("transporters", []() {
+		AiPlayer->check_transporters();
+	});
+	AiPlayer->run_timed("dock_construction", AiCheckDockConstruction);
 	
-	AiForceManagerEachMinute();
+	AiPlayer->run_timed("force_manager_minute", AiForceManagerEachMinute);
+}
+
+/**
+**  Get the quantity of AI active units of a unit type, including its equivalents and the other unit types of its class.
+**
+**  @param player  The player whose units are counted.
+**  @param type    The unit type.
+**
+**  @return The quantity of AI active units.
+*/
+int AiGetEquivalentUnitTypeAiActiveCount(const CPlayer &player, const wyrmgus::unit_type *type)
+{
+	int count = 0;
+
+	//the unit class count already includes the unit type itself
+	const wyrmgus::unit_class *unit_class = type->get_unit_class();
+	if (unit_class != nullptr) {
+		count += player.get_unit_class_ai_active_count(unit_class);
+	} else {
+		count += player.GetUnitTypeAiActiveCount(type);
+	}
+
+	if (type->Slot < static_cast<int>(AiHelpers.Equiv.size())) {
+		for (const wyrmgus::unit_type *equivalent_type : AiHelpers.Equiv[type->Slot]) {
+			count += player.GetUnitTypeAiActiveCount(equivalent_type);
+		}
+	}
+
+	return count;
 }
 
 int AiGetUnitTypeCount(const PlayerAi &pai, const wyrmgus::unit_type *type, const landmass *landmass, const bool include_requests, const bool include_upgrades)
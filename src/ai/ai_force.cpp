@@ -1096,21 +1096,8 @@ void AiForceManager::CheckUnits(int *counter)
 		for (unsigned int j = 0; j < force.UnitTypes.size(); ++j) {
 			const AiUnitType &aiut = force.UnitTypes[j];
 			const unsigned int t = aiut.Type->Slot;
-			const wyrmgus::unit_class *unit_class = aiut.Type->get_unit_class();
 			const int wantedCount = aiut.Want;
-			int e = AiPlayer->Player->GetUnitTypeAiActiveCount(wyrmgus::unit_type::get_all()[t]);
-			if (t < AiHelpers.Equiv.size()) {
-				for (unsigned int k = 0; k < AiHelpers.Equiv[t].size(); ++k) {
-					e += AiPlayer->Player->GetUnitTypeAiActiveCount(AiHelpers.Equiv[t][k]);
-				}
-			}
-			if (unit_class != nullptr) {
-				for (const wyrmgus::unit_type *class_unit_type : unit_class->get_unit_types()) {
-					if (class_unit_type != aiut.Type) {
-						e += AiPlayer->Player->GetUnitTypeAiActiveCount(class_unit_type);
-					}
-				}
-			}
+			const int e = AiGetEquivalentUnitTypeAiActiveCount(*AiPlayer->Player, aiut.Type);
 			const int requested = wantedCount - (e + counter[t] - attacking[t]);
 
 			if (requested > 0) {  // Request it.
@@ -417,6 +417,19 @@ public:
 
 	bool recruit_mercenary(CUnit *mercenary_building, const unit_type *mercenary_type);
 
+	const std::map<std::string, std::chrono::steady_clock::duration> &get_subfunction_times() const
+	{
+		return this->subfunction_times;
+	}
+
+	template <typename function_type>
+	void run_timed(const std::string &name, const function_type &function)
+	{
+		const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+		function();
+		this->subfunction_times[name] += std::chrono::steady_clock::now() - start_time;
+	}
+
 	CPlayer *Player = nullptr;		/// Engine player structure
 	CAiType *AiType = nullptr;		/// AI type of this player AI
 	// controller
@@ -459,6 +472,7 @@ public:
 private:
 	landmass_map<std::vector<CUnit *>> transporters; //AI transporters, mapped to the sea (water "landmass") they belong to
 	site_map<std::vector<std::shared_ptr<unit_ref>>> site_transport_units; //units to be transported to certain sites
+	std::map<std::string, std::chrono::steady_clock::duration> subfunction_times; //total time spent in each AI subfunction, for profiling
 };
 
 /**
@@ -844,6 +858,8 @@ extern void AiSendExplorers();
 //Wyrmgus start
 /// Get the quantity of units belonging to a particular type, possibly including requests
 extern int AiGetUnitTypeCount(const PlayerAi &pai, const wyrmgus::unit_type *type, const landmass *landmass, const bool include_requests, const bool include_upgrades);
+/// Get the quantity of AI active units of a type, its equivalents and the other types of its class
+extern int AiGetEquivalentUnitTypeAiActiveCount(const CPlayer &player, const wyrmgus::unit_type *type);
 /// Get whether the AI has a particular upgrade, possibly including requests and currently under research upgrades
 extern int AiGetUnitTypeRequestedCount(const PlayerAi &pai, const wyrmgus::unit_type *type, const landmass *landmass = nullptr, const wyrmgus::site *settlement = nullptr);
 /// Get whether the AI has a particular upgrade, possibly including requests and currently under research upgrades
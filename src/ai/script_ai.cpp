@@ -1429,6 +1429,13 @@ static int CclAiDump(lua_State *l)
 				printf("\n");
 			}
 			printf("\n");
+
+			// Subfunction times
+			printf("Subfunction times:\n");
+			for (const auto &[subfunction_name, duration] : aip.Ai->get_subfunction_times()) {
+				printf("%s(%lld ms) ", subfunction_name.c_str(), static_cast<long long>(std::chrono::duration_cast<std::chrono::milliseconds>(duration).count()));
+			}
+			printf("\n");
 		}
 	}
 	lua_pushboolean(l, 0);
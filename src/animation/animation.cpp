@@ -51,6 +51,7 @@
 #include "animation/animation_wait.h"
 
 #include "actions.h"
+#include "animation/animation_int_operand.h"
 #include "animation/animation_sequence.h"
 #include "animation/animation_set.h"
 #include "include/config.h"
@@ -80,195 +81,6 @@ int UnitShowAnimation(CUnit &unit, const CAnimation *anim)
 	return UnitShowAnimationScaled(unit, anim, 8);
 }
 
-/**
-**  Parse player number in animation frame
-**
-**  @param unit      Unit of the animation.
-**  @param parseint  Integer to parse.
-**
-**  @return  The parsed value.
-*/
-static int ParseAnimPlayer(const CUnit &unit, const std::string &parseint)
-{
-	if (parseint == "this") {
-		return unit.Player->get_index();
-	}
-
-	return ParseAnimInt(unit, parseint);
-}
-
-/**
-**  Parse integer in animation frame.
-**
-**  @param unit      Unit of the animation.
-**  @param parseint  Integer to parse.
-**
-**  @return  The parsed value.
-*/
-int ParseAnimInt(const CUnit &unit, const std::string &parseint)
-{
-	const CUnit *goal = &unit;
-
-	if (parseint.empty()) {
-		return 0;
-	}
-
-	const std::vector<std::string> str_list = string::split(parseint, '.');
-
-	if (str_list.size() > 1) {
-		const std::string &cur = str_list[1];
-
-		if (parseint[0] == 'v' || parseint[0] == 't') { //unit variable detected
-			if (parseint[0] == 't') {
-				if (unit.CurrentOrder()->has_goal()) {
-					goal = unit.CurrentOrder()->get_goal();
-				} else {
-					return 0;
-				}
-			}
-
-			if (str_list.size() < 3) {
-				throw std::runtime_error("Need also specify the variable for the \"" + cur + "\" tag.");
-			}
-
-			const std::string &next = str_list[2];
-
-			const int index = UnitTypeVar.VariableNameLookup[cur]; //user variables
-			if (index == -1) {
-				if (cur == "ResourcesHeld") {
-					return goal->ResourcesHeld;
-				} else if (cur == "ResourceActive") {
-					return goal->Resource.Active;
-				} else if (cur == "InsideCount") {
-					return static_cast<int>(goal->get_units_inside().size());
-				} else if (cur == "_Distance") {
-					return unit.MapDistanceTo(*goal);
-				}
-
-				throw std::runtime_error("Bad variable name \"" + cur + "\".");
-			}
-
-			if (next == "Value") {
-				//Wyrmgus start
-	//			return goal->Variable[index].Value;
-				return goal->GetModifiedVariable(index, VariableAttribute::Value);
-				//Wyrmgus end
-			} else if (next == "Max") {
-				//Wyrmgus start
-	//			return goal->Variable[index].Max;
-				return goal->GetModifiedVariable(index, VariableAttribute::Max);
-				//Wyrmgus end
-			} else if (next == "Increase") {
-				//Wyrmgus start
-	//			return goal->Variable[index].Increase;
-				return goal->GetModifiedVariable(index, VariableAttribute::Increase);
-				//Wyrmgus end
-			} else if (next == "Enable") {
-				return goal->Variable[index].Enable;
-			} else if (next == "Percent") {
-				//Wyrmgus start
-	//			return goal->Variable[index].Value * 100 / goal->Variable[index].Max;
-				return goal->GetModifiedVariable(index, VariableAttribute::Value) * 100 / goal->GetModifiedVariable(index, VariableAttribute::Max);
-				//Wyrmgus end
-			}
-			return 0;
-		} else if (parseint[0] == 'b' || parseint[0] == 'g') { //unit bool flag detected
-			if (parseint[0] == 'g') {
-				if (unit.CurrentOrder()->has_goal()) {
-					goal = unit.CurrentOrder()->get_goal();
-				} else {
-					return 0;
-				}
-			}
-			const int index = UnitTypeVar.BoolFlagNameLookup[cur];// User bool flags
-			if (index == -1) {
-				throw std::runtime_error("Bad bool-flag name \"" + cur + "\".");
-			}
-			return goal->Type->BoolFlag[index].value;
-		} else if (parseint[0] == 's') { //spell type detected
-			assert_throw(goal->CurrentAction() == UnitAction::SpellCast);
-			const COrder_SpellCast &order = *static_cast<COrder_SpellCast *>(goal->CurrentOrder());
-			const spell &spell = order.GetSpell();
-			if (spell.get_identifier() == cur) {
-				return 1;
-			}
-			return 0;
-		} else if (parseint[0] == 'S') { // check if autocast for this spell available
-			const spell *spell = spell::get(cur);
-			if (unit.is_autocast_spell(spell)) {
-				return 1;
-			}
-			return 0;
-		} else if (parseint[0] == 'r') { //random value
-			if (str_list.size() >= 3) {
-				const std::string &next = str_list[2];
-				const int min = std::stoi(cur);
-				return min + SyncRand(std::stoi(next) - min + 1);
-			} else {
-				return SyncRand(std::stoi(cur) + 1);
-			}
-		} else if (parseint[0] == 'l') { //player number
-			return ParseAnimPlayer(unit, std::string(cur));
-		}
-	}
-
-	//check if we are trying to parse a number
-	assert_throw(isdigit(parseint[0]) || parseint[0] == '-');
-
-	return std::stoi(parseint);
-}
-
-/**
-**  Parse flags list in animation frame.
-**
-**  @param unit       Unit of the animation.
-**  @param parseflag  Flag list to parse.
-**
-**  @return The parsed value.
-*/
-int ParseAnimFlags(const CUnit &unit, const char *parseflag)
-{
-	std::array<char, 100> s{};
-	int flags = 0;
-
-	strcpy(s.data(), parseflag);
-	char *cur = s.data();
-	char *next = s.data();
-
-	while (next && *next) {
-		next = strchr(cur, '.');
-		if (next) {
-			*next = '\0';
-			++next;
-		}
-
-		if (unit.Anim.Anim->Type == AnimationSpawnMissile) {
-			if (!strcmp(cur, "none")) {
-				flags = SM_None;
-				return flags;
-			} else if (!strcmp(cur, "damage")) {
-				flags |= SM_Damage;
-			} else if (!strcmp(cur, "totarget")) {
-				flags |= SM_ToTarget;
-			} else if (!strcmp(cur, "pixel")) {
-				flags |= SM_Pixel;
-			} else if (!strcmp(cur, "reltarget")) {
-				flags |= SM_RelTarget;
-			} else if (!strcmp(cur, "ranged")) {
-				flags |= SM_Ranged;
-			}  else if (!strcmp(cur, "setdirection")) {
-				flags |= SM_SetDirection;
-			} else {
-				throw std::runtime_error("Unknown animation flag: \"" + std::string(cur) + "\".");
-			}
-		}
-
-		cur = next;
-	}
-
-	return flags;
-}
-
 /**
 **  Show unit animation.
 **
@@ -97,6 +97,11 @@ public:
 		Q_UNUSED(sequence);
 	}
 
+	//resolve the references to other data, after the database has been loaded
+	virtual void initialize()
+	{
+	}
+
 	const CAnimation *get_next() const
 	{
 		return this->next;
@@ -122,6 +127,3 @@ extern void AnimationCclRegister();
 extern int UnitShowAnimationScaled(CUnit &unit, const CAnimation *anim, int scale);
 /// Handle the animation of a unit
 extern int UnitShowAnimation(CUnit &unit, const CAnimation *anim);
-
-extern int ParseAnimInt(const CUnit &unit, const std::string &parseint);
-extern int ParseAnimFlags(const CUnit &unit, const char *parseflag);
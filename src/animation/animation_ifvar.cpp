@@ -72,8 +72,8 @@ void CAnimation_IfVar::Action(CUnit &unit, int &/*move*/, int /*scale*/) const
 {
 	assert_throw(unit.Anim.Anim == this);
 
-	const int lop = ParseAnimInt(unit, this->leftVar);
-	const int rop = ParseAnimInt(unit, this->rightVar);
+	const int lop = this->left_operand.evaluate(unit);
+	const int rop = this->right_operand.evaluate(unit);
 	const bool cond = this->binOpFunc(lop, rop);
 
 	if (cond) {
@@ -89,7 +89,7 @@ void CAnimation_IfVar::Init(const char *s, animation_sequence *sequence)
 
 	const std::vector<std::string> str_list = wyrmgus::string::split(s, ' ');
 
-	this->leftVar = str_list.at(0);
+	this->left_operand = animation_int_operand(str_list.at(0));
 
 	const std::string op = str_list.at(1);
 
@@ -131,9 +131,15 @@ void CAnimation_IfVar::Init(const char *s, animation_sequence *sequence)
 		}
 	}
 
-	this->rightVar = str_list.at(2);
+	this->right_operand = animation_int_operand(str_list.at(2));
 
 	const std::string label = str_list.at(3);
 
 	sequence->find_label_later(&this->gotoLabel, label);
 }
+
+void CAnimation_IfVar::initialize()
+{
+	this->left_operand.initialize();
+	this->right_operand.initialize();
+}
@@ -29,6 +29,7 @@
 #pragma once
 
 #include "animation/animation.h"
+#include "animation/animation_int_operand.h"
 
 class CAnimation_IfVar final : public CAnimation
 {
@@ -39,13 +40,14 @@ public:
 
 	virtual void Action(CUnit &unit, int &move, int scale) const override;
 	virtual void Init(const char *s, animation_sequence *sequence) override;
+	virtual void initialize() override;
 
 private:
 	typedef bool BinOpFunc(int lhs, int rhs);
 
 private:
-	std::string leftVar;
-	std::string rightVar;
+	wyrmgus::animation_int_operand left_operand;
+	wyrmgus::animation_int_operand right_operand;
 	BinOpFunc *binOpFunc = nullptr;
 	const CAnimation *gotoLabel = nullptr;
 };
@@ -0,0 +1,217 @@
+//       _________ __                 __
+//      /   _____//  |_____________ _/  |______     ____  __ __  ______
+//      \_____  \\   __\_  __ \__  \\   __\__  \   / ___\|  |  \/  ___/
+//      /        \|  |  |  | \// __ \|  |  / __ \_/ /_/  >  |  /\___ |
+//     /_______  /|__|  |__|  (____  /__| (____  /\___  /|____//____  >
+//             \/                  \/          \//_____/            \/
+//  ______________________                           ______________________
+//                        T H E   W A R   B E G I N S
+//         Stratagus - A free fantasy real time strategy game engine
+//
+//      (c) Copyright 2026 by Andrettin
+//
+//      This program is free software; you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation; only version 2 of the License.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program; if not, write to the Free Software
+//      Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+//      02111-1307, USA.
+
+#include "stratagus.h"
+
+#include "animation/animation_int_operand.h"
+
+#include "action/action_spellcast.h"
+#include "actions.h"
+#include "player/player.h"
+#include "script.h"
+#include "spell/spell.h"
+#include "unit/unit.h"
+#include "unit/unit_type.h"
+#include "util/assert_util.h"
+#include "util/string_util.h"
+#include "util/util.h"
+
+namespace wyrmgus {
+
+animation_int_operand::animation_int_operand(const std::string &str)
+{
+	if (str.empty()) {
+		return;
+	}
+
+	const std::vector<std::string> str_list = string::split(str, '.');
+
+	if (str_list.size() > 1) {
+		const std::string &cur = str_list[1];
+
+		switch (str[0]) {
+			case 'v': //unit variable
+			case 't': //goal variable
+				if (str_list.size() < 3) {
+					throw std::runtime_error("Need also specify the variable for the \"" + cur + "\" tag.");
+				}
+
+				this->type = operand_type::variable;
+				this->uses_goal = str[0] == 't';
+				this->name = cur;
+
+				if (str_list[2] == "Value") {
+					this->field = variable_field::value;
+				} else if (str_list[2] == "Max") {
+					this->field = variable_field::max;
+				} else if (str_list[2] == "Increase") {
+					this->field = variable_field::increase;
+				} else if (str_list[2] == "Enable") {
+					this->field = variable_field::enable;
+				} else if (str_list[2] == "Percent") {
+					this->field = variable_field::percent;
+				}
+				return;
+			case 'b': //unit bool flag
+			case 'g': //goal bool flag
+				this->type = operand_type::bool_flag;
+				this->uses_goal = str[0] == 'g';
+				this->name = cur;
+				return;
+			case 's': //spell being cast
+				this->type = operand_type::current_spell;
+				this->name = cur;
+				return;
+			case 'S': //whether autocast is enabled for the spell
+				this->type = operand_type::autocast_spell;
+				this->name = cur;
+				return;
+			case 'r': //random value
+				this->type = operand_type::random;
+				if (str_list.size() >= 3) {
+					this->value = std::stoi(cur);
+					this->max_value = std::stoi(str_list[2]);
+				} else {
+					this->value = 0;
+					this->max_value = std::stoi(cur);
+				}
+				return;
+			case 'l': //player number
+				if (cur == "this") {
+					this->type = operand_type::player;
+				} else {
+					this->value = std::stoi(cur);
+				}
+				return;
+			default:
+				break;
+		}
+	}
+
+	//check if we are trying to parse a number
+	assert_throw(isdigit(str[0]) || str[0] == '-');
+
+	this->value = std::stoi(str);
+}
+
+void animation_int_operand::initialize()
+{
+	switch (this->type) {
+		case operand_type::variable:
+			this->index = UnitTypeVar.VariableNameLookup[this->name]; //user variables
+
+			if (this->index == -1) {
+				if (this->name == "ResourcesHeld") {
+					this->type = operand_type::resources_held;
+				} else if (this->name == "ResourceActive") {
+					this->type = operand_type::resource_active;
+				} else if (this->name == "InsideCount") {
+					this->type = operand_type::inside_count;
+				} else if (this->name == "_Distance") {
+					this->type = operand_type::distance;
+				} else {
+					throw std::runtime_error("Bad variable name \"" + this->name + "\".");
+				}
+			}
+			break;
+		case operand_type::bool_flag:
+			this->index = UnitTypeVar.BoolFlagNameLookup[this->name]; //user bool flags
+
+			if (this->index == -1) {
+				throw std::runtime_error("Bad bool-flag name \"" + this->name + "\".");
+			}
+			break;
+		case operand_type::current_spell:
+			//a spell which does not exist can never be the one being cast
+			this->checked_spell = spell::try_get(this->name);
+			break;
+		case operand_type::autocast_spell:
+			this->checked_spell = spell::get(this->name);
+			break;
+		default:
+			break;
+	}
+
+	this->name.clear();
+}
+
+int animation_int_operand::evaluate(const CUnit &unit) const
+{
+	const CUnit *goal = &unit;
+
+	if (this->uses_goal) {
+		if (!unit.CurrentOrder()->has_goal()) {
+			return 0;
+		}
+
+		goal = unit.CurrentOrder()->get_goal();
+	}
+
+	switch (this->type) {
+		case operand_type::literal:
+			return this->value;
+		case operand_type::variable:
+			switch (this->field) {
+				case variable_field::value:
+					return goal->GetModifiedVariable(this->index, VariableAttribute::Value);
+				case variable_field::max:
+					return goal->GetModifiedVariable(this->index, VariableAttribute::Max);
+				case variable_field::increase:
+					return goal->GetModifiedVariable(this->index, VariableAttribute::Increase);
+				case variable_field::enable:
+					return goal->Variable[this->index].Enable;
+				case variable_field::percent:
+					return goal->GetModifiedVariable(this->index, VariableAttribute::Value) * 100 / goal->GetModifiedVariable(this->index, VariableAttribute::Max);
+				default:
+					return 0;
+			}
+		case operand_type::resources_held:
+			return goal->ResourcesHeld;
+		case operand_type::resource_active:
+			return goal->Resource.Active;
+		case operand_type::inside_count:
+			return static_cast<int>(goal->get_units_inside().size());
+		case operand_type::distance:
+			return unit.MapDistanceTo(*goal);
+		case operand_type::bool_flag:
+			return goal->Type->BoolFlag[this->index].value;
+		case operand_type::current_spell: {
+			assert_throw(goal->CurrentAction() == UnitAction::SpellCast);
+			const COrder_SpellCast &order = *static_cast<COrder_SpellCast *>(goal->CurrentOrder());
+			return &order.GetSpell() == this->checked_spell ? 1 : 0;
+		}
+		case operand_type::autocast_spell:
+			return unit.is_autocast_spell(this->checked_spell) ? 1 : 0;
+		case operand_type::random:
+			return this->value + SyncRand(this->max_value - this->value + 1);
+		case operand_type::player:
+			return unit.Player->get_index();
+	}
+
+	return 0;
+}
+
+}
@@ -0,0 +1,84 @@
+//       _________ __                 __
+//      /   _____//  |_____________ _/  |______     ____  __ __  ______
+//      \_____  \\   __\_  __ \__  \\   __\__  \   / ___\|  |  \/  ___/
+//      /        \|  |  |  | \// __ \|  |  / __ \_/ /_/  >  |  /\___ |
+//     /_______  /|__|  |__|  (____  /__| (____  /\___  /|____//____  >
+//             \/                  \/          \//_____/            \/
+//  ______________________                           ______________________
+//                        T H E   W A R   B E G I N S
+//         Stratagus - A free fantasy real time strategy game engine
+//
+//      (c) Copyright 2026 by Andrettin
+//
+//      This program is free software; you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation; only version 2 of the License.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program; if not, write to the Free Software
+//      Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+//      02111-1307, USA.
+
+#pragma once
+
+class CUnit;
+
+namespace wyrmgus {
+
+class spell;
+
+//an integer operand of an animation, parsed when the animation is defined and resolved when it is initialized, so that executing the animation requires no string processing
+class animation_int_operand final
+{
+private:
+	enum class operand_type {
+		literal,
+		variable,
+		resources_held,
+		resource_active,
+		inside_count,
+		distance,
+		bool_flag,
+		current_spell,
+		autocast_spell,
+		random,
+		player
+	};
+
+	enum class variable_field {
+		none,
+		value,
+		max,
+		increase,
+		enable,
+		percent
+	};
+
+public:
+	animation_int_operand()
+	{
+	}
+
+	explicit animation_int_operand(const std::string &str);
+
+	void initialize();
+
+	int evaluate(const CUnit &unit) const;
+
+private:
+	operand_type type = operand_type::literal;
+	bool uses_goal = false; //whether the operand refers to the goal of the unit's current order instead of the unit itself
+	int value = 0; //the literal value, or the minimum for random values
+	int max_value = 0; //the maximum for random values
+	int index = -1; //the variable or bool flag index
+	variable_field field = variable_field::none;
+	const wyrmgus::spell *checked_spell = nullptr;
+	std::string name; //the variable, bool flag or spell name, until it is resolved
+};
+
+}
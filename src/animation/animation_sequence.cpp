@@ -153,6 +153,7 @@ void animation_sequence::initialize()
 
 	for (const std::unique_ptr<CAnimation> &anim : this->animations) {
 		MapAnimSound(anim.get());
+		anim->initialize();
 	}
 
 	data_entry::initialize();
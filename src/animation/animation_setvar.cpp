@@ -50,16 +50,11 @@ void CAnimation_SetVar::Action(CUnit &unit, int &/*move*/, int /*scale*/) const
 		return;
 	}
 
-	const std::vector<std::string> str_list = string::split(this->var_str, '.');
-
-	const int index = UnitTypeVar.VariableNameLookup[str_list[0]]; //user variables
-	if (index == -1) {
-		throw std::runtime_error("Bad variable name \"" + str_list[0] + "\".");
-	}
+	const int index = this->variable_index;
 
 	const int rop = this->value;
 	int value = 0;
-	if (str_list[1] == "Value") {
+	if (this->sets_value) {
 		value = goal->Variable[index].Value;
 	}
 
@@ -73,7 +68,7 @@ void CAnimation_SetVar::Action(CUnit &unit, int &/*move*/, int /*scale*/) const
 
 	const int old_value = goal->Variable[index].Value;
 
-	if (str_list[1] == "Value") {
+	if (this->sets_value) {
 		goal->Variable[index].Value = value;
 	}
 
@@ -117,3 +112,15 @@ void CAnimation_SetVar::Init(const char *s, animation_sequence *sequence)
 	value_str.assign(str, begin, end - begin);
 	this->value = std::stoi(value_str);
 }
+
+void CAnimation_SetVar::initialize()
+{
+	const std::vector<std::string> str_list = string::split(this->var_str, '.');
+
+	this->variable_index = UnitTypeVar.VariableNameLookup[str_list[0]]; //user variables
+	if (this->variable_index == -1) {
+		throw std::runtime_error("Bad variable name \"" + str_list[0] + "\".");
+	}
+
+	this->sets_value = str_list.at(1) == "Value";
+}
@@ -39,9 +39,12 @@ public:
 
 	virtual void Action(CUnit &unit, int &move, int scale) const override;
 	virtual void Init(const char *s, animation_sequence *sequence) override;
+	virtual void initialize() override;
 
 private:
 	SetVar_ModifyTypes mod = SetVar_ModifyTypes::modSet;
 	std::string var_str;
+	int variable_index = -1;
+	bool sets_value = false; //whether the variable's value is the field being set
 	int value = 0;
 };
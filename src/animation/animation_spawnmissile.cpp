@@ -41,23 +41,24 @@
 #include "pathfinder/pathfinder.h"
 #include "unit/unit.h"
 #include "util/assert_util.h"
+#include "util/string_util.h"
 
 void CAnimation_SpawnMissile::Action(CUnit &unit, int &/*move*/, int /*scale*/) const
 {
 	assert_throw(unit.Anim.Anim == this);
 
-	const int startx = ParseAnimInt(unit, this->startXStr);
-	const int starty = ParseAnimInt(unit, this->startYStr);
-	const int destx = ParseAnimInt(unit, this->destXStr);
-	const int desty = ParseAnimInt(unit, this->destYStr);
-	const SpawnMissile_Flags flags = (SpawnMissile_Flags)(ParseAnimFlags(unit, this->flagsStr.c_str()));
-	const int offsetnum = ParseAnimInt(unit, this->offsetNumStr);
+	const int startx = this->start_x.evaluate(unit);
+	const int starty = this->start_y.evaluate(unit);
+	const int destx = this->dest_x.evaluate(unit);
+	const int desty = this->dest_y.evaluate(unit);
+	const SpawnMissile_Flags flags = static_cast<SpawnMissile_Flags>(this->flags);
+	const int offsetnum = this->offset_num.evaluate(unit);
 	const CUnit *goal = flags & SM_RelTarget ? unit.CurrentOrder()->get_goal() : &unit;
 	const int dir = ((goal->Direction + NextDirection / 2) & 0xFF) / NextDirection;
 	const PixelPos moff = goal->Type->MissileOffsets[dir][!offsetnum ? 0 : offsetnum - 1];
 	PixelPos start;
 	PixelPos dest;
-	wyrmgus::missile_type *mtype = wyrmgus::missile_type::try_get(this->missileTypeStr);
+	wyrmgus::missile_type *mtype = this->missile_type;
 	if (mtype == nullptr) {
 		return;
 	}
@@ -138,6 +139,45 @@ void CAnimation_SpawnMissile::Action(CUnit &unit, int &/*move*/, int /*scale*/)
 	}
 }
 
+/**
+**  Parse the flags list of a spawn missile animation.
+**
+**  @param flags_str  Flag list to parse, separated by dots.
+**
+**  @return The parsed flags.
+*/
+static int ParseSpawnMissileFlags(const std::string &flags_str)
+{
+	int flags = SM_None;
+
+	for (const std::string &flag_str : wyrmgus::string::split(flags_str, '.')) {
+		if (flag_str.empty()) {
+			//an omitted flags operand, or a trailing separator
+			continue;
+		}
+
+		if (flag_str == "none") {
+			return SM_None;
+		} else if (flag_str == "damage") {
+			flags |= SM_Damage;
+		} else if (flag_str == "totarget") {
+			flags |= SM_ToTarget;
+		} else if (flag_str == "pixel") {
+			flags |= SM_Pixel;
+		} else if (flag_str == "reltarget") {
+			flags |= SM_RelTarget;
+		} else if (flag_str == "ranged") {
+			flags |= SM_Ranged;
+		} else if (flag_str == "setdirection") {
+			flags |= SM_SetDirection;
+		} else {
+			throw std::runtime_error("Unknown animation flag: \"" + flag_str + "\".");
+		}
+	}
+
+	return flags;
+}
+
 /*
 **  s = "missileType startX startY destX destY [flag1[.flagN]] [missileoffset]"
 */
@@ -152,27 +192,46 @@ void CAnimation_SpawnMissile::Init(const char *s, animation_sequence *sequence)
 	size_t end = str.find(' ', begin);
 	this->missileTypeStr.assign(str, begin, end - begin);
 
+	std::string operand_str;
+
 	begin = std::min(len, str.find_first_not_of(' ', end));
 	end = std::min(len, str.find(' ', begin));
-	this->startXStr.assign(str, begin, end - begin);
+	operand_str.assign(str, begin, end - begin);
+	this->start_x = wyrmgus::animation_int_operand(operand_str);
 
 	begin = std::min(len, str.find_first_not_of(' ', end));
 	end = std::min(len, str.find(' ', begin));
-	this->startYStr.assign(str, begin, end - begin);
+	operand_str.assign(str, begin, end - begin);
+	this->start_y = wyrmgus::animation_int_operand(operand_str);
 
 	begin = std::min(len, str.find_first_not_of(' ', end));
 	end = std::min(len, str.find(' ', begin));
-	this->destXStr.assign(str, begin, end - begin);
+	operand_str.assign(str, begin, end - begin);
+	this->dest_x = wyrmgus::animation_int_operand(operand_str);
 
 	begin = std::min(len, str.find_first_not_of(' ', end));
 	end = std::min(len, str.find(' ', begin));
-	this->destYStr.assign(str, begin, end - begin);
+	operand_str.assign(str, begin, end - begin);
+	this->dest_y = wyrmgus::animation_int_operand(operand_str);
 
 	begin = std::min(len, str.find_first_not_of(' ', end));
 	end = std::min(len, str.find(' ', begin));
-	this->flagsStr.assign(str, begin, end - begin);
+	operand_str.assign(str, begin, end - begin);
+	this->flags = ParseSpawnMissileFlags(operand_str);
 
 	begin = std::min(len, str.find_first_not_of(' ', end));
 	end = std::min(len, str.find(' ', begin));
-	this->offsetNumStr.assign(str, begin, end - begin);
+	operand_str.assign(str, begin, end - begin);
+	this->offset_num = wyrmgus::animation_int_operand(operand_str);
+}
+
+void CAnimation_SpawnMissile::initialize()
+{
+	this->missile_type = wyrmgus::missile_type::try_get(this->missileTypeStr);
+
+	this->start_x.initialize();
+	this->start_y.initialize();
+	this->dest_x.initialize();
+	this->dest_y.initialize();
+	this->offset_num.initialize();
 }
@@ -29,6 +29,11 @@
 #pragma once
 
 #include "animation/animation.h"
+#include "animation/animation_int_operand.h"
+
+namespace wyrmgus {
+	class missile_type;
+}
 
 //SpawnMissile flags
 enum SpawnMissile_Flags {
@@ -51,13 +56,15 @@ public:
 
 	virtual void Action(CUnit &unit, int &move, int scale) const override;
 	virtual void Init(const char *s, animation_sequence *sequence) override;
+	virtual void initialize() override;
 
 private:
 	std::string missileTypeStr;
-	std::string startXStr;
-	std::string startYStr;
-	std::string destXStr;
-	std::string destYStr;
-	std::string flagsStr;
-	std::string offsetNumStr;
+	wyrmgus::missile_type *missile_type = nullptr;
+	wyrmgus::animation_int_operand start_x;
+	wyrmgus::animation_int_operand start_y;
+	wyrmgus::animation_int_operand dest_x;
+	wyrmgus::animation_int_operand dest_y;
+	int flags = SM_None;
+	wyrmgus::animation_int_operand offset_num;
 };
@@ -140,6 +140,7 @@ class defines final : public defines_base, public singleton<defines>
 	Q_PROPERTY(int scaled_tile_height READ get_scaled_tile_height CONSTANT)
 	Q_PROPERTY(bool deselect_in_mine MEMBER deselect_in_mine READ is_deselect_in_mine_enabled)
 	Q_PROPERTY(int population_per_unit MEMBER population_per_unit READ get_population_per_unit)
+	Q_PROPERTY(int autocast_searches_per_cycle MEMBER autocast_searches_per_cycle READ get_autocast_searches_per_cycle)
 	Q_PROPERTY(wyrmgus::icon* default_quest_icon MEMBER default_quest_icon)
 	Q_PROPERTY(wyrmgus::map_presets* map_editor_default_map_presets MEMBER map_editor_default_map_presets)
 	Q_PROPERTY(QString default_menu_background_file READ get_default_menu_background_file_qstring NOTIFY changed)
@@ -493,6 +494,11 @@ public:
 		return this->population_per_unit;
 	}
 
+	int get_autocast_searches_per_cycle() const
+	{
+		return this->autocast_searches_per_cycle;
+	}
+
 	const std::map<trigger_type, int> get_trigger_type_none_random_weights() const
 	{
 		return this->trigger_type_none_random_weights;
@@ -624,6 +630,7 @@ private:
 	int destroyed_overlay_terrain_decay_threshold = 0;
 	bool deselect_in_mine = true; //deselect workers when they enter a mine
 	int population_per_unit = 0; //the number of people a unit represents
+	int autocast_searches_per_cycle = 64; //the budget of autocast target searches per cycle, above which casters are spread over multiple cycles; 0 means no limit
 	std::map<trigger_type, int> trigger_type_none_random_weights; //the weight for no trigger happening for a given trigger type's random trigger selection
 	icon *default_quest_icon = nullptr;
 	map_presets *map_editor_default_map_presets = nullptr;
@@ -0,0 +1,325 @@
+//       _________ __                 __
+//      /   _____//  |_____________ _/  |______     ____  __ __  ______
+//      \_____  \\   __\_  __ \__  \\   __\__  \   / ___\|  |  \/  ___/
+//      /        \|  |  |  | \// __ \|  |  / __ \_/ /_/  >  |  /\___ |
+//     /_______  /|__|  |__|  (____  /__| (____  /\___  /|____//____  >
+//             \/                  \/          \//_____/            \/
+//  ______________________                           ______________________
+//                        T H E   W A R   B E G I N S
+//         Stratagus - A free fantasy real time strategy game engine
+//
+//      (c) Copyright 2026 by Andrettin
+//
+//      This program is free software; you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation; only version 2 of the License.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program; if not, write to the Free Software
+//      Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+//      02111-1307, USA.
+
+#include "stratagus.h"
+
+#include "database/gsml_binary.h"
+
+#include "database/gsml_data.h"
+#include "database/gsml_operator.h"
+#include "database/gsml_property.h"
+#include "util/path_util.h"
+
+#pragma warning(push, 0)
+#include <QDataStream>
+#include <QFile>
+#pragma warning(pop)
+
+namespace wyrmgus {
+
+static constexpr quint32 gsml_binary_magic = 0x57475342; //"WGSB"
+static constexpr quint32 gsml_binary_version = 2;
+
+static constexpr quint8 gsml_binary_property_element = 0;
+static constexpr quint8 gsml_binary_scope_element = 1;
+
+//get a value as the text gsml parser would read it: values written for the text format are quoted and escaped, while the binary format stores them as they are, so that reading them needs no tokenizing
+static std::string get_gsml_binary_value(const std::string &value)
+{
+	if (value.size() < 2 || value.front() != '"' || value.back() != '"') {
+		return value;
+	}
+
+	std::string unescaped_value;
+	unescaped_value.reserve(value.size() - 2);
+
+	for (size_t i = 1; i < value.size() - 1; ++i) {
+		const char c = value[i];
+
+		if (c != '\\' || i + 1 == value.size() - 1) {
+			unescaped_value += c;
+			continue;
+		}
+
+		++i;
+		switch (value[i]) {
+			case 'n':
+				unescaped_value += '\n';
+				break;
+			case 't':
+				unescaped_value += '\t';
+				break;
+			case 'r':
+				unescaped_value += '\r';
+				break;
+			case '"':
+			case '\\':
+				unescaped_value += value[i];
+				break;
+			default:
+				unescaped_value += '\\';
+				unescaped_value += value[i];
+				break;
+		}
+	}
+
+	return unescaped_value;
+}
+
+class gsml_binary_writer final
+{
+public:
+	gsml_binary_writer() : stream(&this->body, QIODevice::WriteOnly)
+	{
+		this->stream.setVersion(QDataStream::Qt_6_0);
+	}
+
+	void write_scope(const gsml_data &data)
+	{
+		this->write_string(data.get_tag());
+		this->stream << static_cast<quint8>(data.get_operator());
+
+		const std::vector<std::string> &values = data.get_values();
+		this->stream << static_cast<quint32>(values.size());
+		for (const std::string &value : values) {
+			this->write_string(get_gsml_binary_value(value));
+		}
+
+		quint32 element_count = 0;
+		data.for_each_element([&](const gsml_property &property) {
+			Q_UNUSED(property)
+			++element_count;
+		}, [&](const gsml_data &child_scope) {
+			Q_UNUSED(child_scope)
+			++element_count;
+		});
+
+		this->stream << element_count;
+
+		data.for_each_element([&](const gsml_property &property) {
+			this->stream << gsml_binary_property_element;
+			this->write_string(property.get_key());
+			this->stream << static_cast<quint8>(property.get_operator());
+			this->write_string(get_gsml_binary_value(property.get_value()));
+		}, [&](const gsml_data &child_scope) {
+			this->stream << gsml_binary_scope_element;
+			this->write_scope(child_scope);
+		});
+	}
+
+	void write_file(const std::filesystem::path &filepath) const
+	{
+		QFile file(path::to_qstring(filepath));
+
+		if (!file.open(QIODevice::WriteOnly)) {
+			throw std::runtime_error("Failed to open file \"" + filepath.string() + "\" for writing binary gsml data.");
+		}
+
+		QDataStream file_stream(&file);
+		file_stream.setVersion(QDataStream::Qt_6_0);
+
+		file_stream << gsml_binary_magic << gsml_binary_version;
+
+		file_stream << static_cast<quint32>(this->strings.size());
+		for (const std::string *str : this->strings) {
+			file_stream << QByteArray::fromStdString(*str);
+		}
+
+		file_stream.writeRawData(this->body.constData(), static_cast<int>(this->body.size()));
+
+		if (file_stream.status() != QDataStream::Ok) {
+			throw std::runtime_error("Failed to write binary gsml data to file \"" + filepath.string() + "\".");
+		}
+	}
+
+private:
+	void write_string(const std::string &str)
+	{
+		const auto [iterator, inserted] = this->string_indices.try_emplace(str, static_cast<quint32>(this->strings.size()));
+
+		if (inserted) {
+			this->strings.push_back(&iterator->first);
+		}
+
+		this->stream << iterator->second;
+	}
+
+	QByteArray body;
+	QDataStream stream;
+	std::unordered_map<std::string, quint32> string_indices;
+	std::vector<const std::string *> strings; //strings in order of their indices
+};
+
+class gsml_binary_reader final
+{
+public:
+	explicit gsml_binary_reader(const QByteArray &bytes) : stream(bytes)
+	{
+		this->stream.setVersion(QDataStream::Qt_6_0);
+	}
+
+	gsml_data read()
+	{
+		quint32 magic = 0;
+		quint32 version = 0;
+		this->stream >> magic >> version;
+
+		if (magic != gsml_binary_magic || version != gsml_binary_version) {
+			throw std::runtime_error("Invalid binary gsml data header.");
+		}
+
+		quint32 string_count = 0;
+		this->stream >> string_count;
+		this->check_status();
+
+		//the count comes from the file, so only reserve as many strings as the remaining bytes could hold, given that each string has at least its length prefix
+		const qint64 max_string_count = this->stream.device()->bytesAvailable() / static_cast<qint64>(sizeof(quint32));
+		this->strings.reserve(static_cast<size_t>(std::min<qint64>(string_count, max_string_count)));
+
+		for (quint32 i = 0; i < string_count; ++i) {
+			QByteArray str;
+			this->stream >> str;
+			this->check_status();
+			this->strings.push_back(str.toStdString());
+		}
+
+		gsml_data data = this->read_scope();
+		this->check_status();
+		return data;
+	}
+
+private:
+	gsml_data read_scope()
+	{
+		std::string tag = this->read_string();
+		const gsml_operator scope_operator = this->read_operator();
+
+		gsml_data data(std::move(tag), scope_operator);
+
+		quint32 value_count = 0;
+		this->stream >> value_count;
+		this->check_status();
+
+		for (quint32 i = 0; i < value_count; ++i) {
+			data.add_value(this->read_string());
+		}
+
+		quint32 element_count = 0;
+		this->stream >> element_count;
+		this->check_status();
+
+		for (quint32 i = 0; i < element_count; ++i) {
+			quint8 element_type = 0;
+			this->stream >> element_type;
+			this->check_status();
+
+			if (element_type == gsml_binary_property_element) {
+				std::string key = this->read_string();
+				const gsml_operator property_operator = this->read_operator();
+				std::string value = this->read_string();
+				data.add_property(std::move(key), property_operator, std::move(value));
+			} else if (element_type == gsml_binary_scope_element) {
+				data.add_child(this->read_scope());
+			} else {
+				throw std::runtime_error("Invalid binary gsml element type: " + std::to_string(element_type) + ".");
+			}
+		}
+
+		return data;
+	}
+
+	const std::string &read_string()
+	{
+		quint32 index = 0;
+		this->stream >> index;
+		this->check_status();
+
+		if (index >= this->strings.size()) {
+			throw std::runtime_error("Invalid binary gsml string index: " + std::to_string(index) + ".");
+		}
+
+		return this->strings[index];
+	}
+
+	gsml_operator read_operator()
+	{
+		quint8 operator_value = 0;
+		this->stream >> operator_value;
+		this->check_status();
+
+		if (operator_value > static_cast<quint8>(gsml_operator::greater_than_or_equality)) {
+			throw std::runtime_error("Invalid binary gsml operator: " + std::to_string(operator_value) + ".");
+		}
+
+		return static_cast<gsml_operator>(operator_value);
+	}
+
+	void check_status() const
+	{
+		if (this->stream.status() != QDataStream::Ok) {
+			throw std::runtime_error("Truncated or corrupted binary gsml data.");
+		}
+	}
+
+	QDataStream stream;
+	std::vector<std::string> strings;
+};
+
+void write_gsml_binary_file(const gsml_data &data, const std::filesystem::path &filepath)
+{
+	gsml_binary_writer writer;
+	writer.write_scope(data);
+	writer.write_file(filepath);
+}
+
+gsml_data read_gsml_binary_file(const std::filesystem::path &filepath)
+{
+	QFile file(path::to_qstring(filepath));
+
+	if (!file.open(QIODevice::ReadOnly)) {
+		throw std::runtime_error("Failed to open binary gsml file \"" + filepath.string() + "\".");
+	}
+
+	const qint64 size = file.size();
+	const uchar *mapped_data = file.map(0, size);
+
+	QByteArray bytes;
+	if (mapped_data != nullptr) {
+		//read directly from the mapped file, without copying it
+		bytes = QByteArray::fromRawData(reinterpret_cast<const char *>(mapped_data), size);
+	} else {
+		bytes = file.readAll();
+	}
+
+	try {
+		gsml_binary_reader reader(bytes);
+		return reader.read();
+	} catch (...) {
+		std::throw_with_nested(std::runtime_error("Failed to read binary gsml file \"" + filepath.string() + "\"."));
+	}
+}
+
+}
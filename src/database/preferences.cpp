@@ -60,13 +60,17 @@ preferences::preferences() : difficulty(difficulty::normal), hotkey_setup(hotkey
 {
 }
 
+preferences::~preferences()
+{
+}
+
 void preferences::load()
 {
 	this->load_file();
 	this->initialize();
 }
 
-void preferences::load_file()
+static gsml_data parse_preferences_file()
 {
 	std::filesystem::path preferences_path = preferences::get_path();
 
@@ -74,7 +78,7 @@ void preferences::load_file()
 		preferences_path = preferences::get_fallback_path();
 
 		if (!std::filesystem::exists(preferences_path)) {
-			return;
+			return gsml_data();
 		}
 	}
 
@@ -88,6 +92,26 @@ void preferences::load_file()
 		log::log_error("Failed to parse preferences file.");
 	}
 
+	return data;
+}
+
+void preferences::start_parsing_file()
+{
+	//reading and tokenizing the file does not depend on the database, so it can be done in the background while the database is loading
+	this->parsed_file_data = QtConcurrent::run(parse_preferences_file);
+}
+
+void preferences::load_file()
+{
+	gsml_data data;
+
+	if (this->parsed_file_data.isValid()) {
+		data = this->parsed_file_data.takeResult();
+		this->parsed_file_data = QFuture<gsml_data>();
+	} else {
+		data = parse_preferences_file();
+	}
+
 	data.process(this);
 }
 
@@ -109,6 +133,7 @@ void preferences::save() const
 	data.add_property("difficulty", enum_converter<wyrmgus::difficulty>::to_string(this->get_difficulty()));
 	data.add_property("sound_effects_enabled", string::from_bool(this->are_sound_effects_enabled()));
 	data.add_property("sound_effects_volume", std::to_string(this->get_sound_effects_volume()));
+	data.add_property("max_sound_voices", std::to_string(this->get_max_sound_voices()));
 	data.add_property("music_enabled", string::from_bool(this->is_music_enabled()));
 	data.add_property("music_volume", std::to_string(this->get_music_volume()));
 	data.add_property("hotkey_setup", enum_converter<wyrmgus::hotkey_setup>::to_string(this->get_hotkey_setup()));
@@ -56,6 +56,7 @@ class preferences final : public QObject, public singleton<preferences>
 	Q_PROPERTY(wyrmgus::difficulty difficulty READ get_difficulty WRITE set_difficulty)
 	Q_PROPERTY(bool sound_effects_enabled READ are_sound_effects_enabled WRITE set_sound_effects_enabled NOTIFY sound_effects_enabled_changed)
 	Q_PROPERTY(int sound_effects_volume READ get_sound_effects_volume WRITE set_sound_effects_volume NOTIFY sound_effects_volume_changed)
+	Q_PROPERTY(int max_sound_voices MEMBER max_sound_voices READ get_max_sound_voices NOTIFY changed)
 	Q_PROPERTY(bool music_enabled READ is_music_enabled WRITE set_music_enabled NOTIFY music_enabled_changed)
 	Q_PROPERTY(int music_volume READ get_music_volume WRITE set_music_volume NOTIFY music_volume_changed)
 	Q_PROPERTY(wyrmgus::hotkey_setup hotkey_setup READ get_hotkey_setup WRITE set_hotkey_setup)
@@ -84,8 +85,10 @@ public:
 	static std::filesystem::path get_fallback_path();
 
 	preferences();
+	~preferences();
 
 	void load();
+	void start_parsing_file();
 	void load_file();
 	Q_INVOKABLE void save() const;
 	void process_gsml_property(const gsml_property &property);
@@ -284,6 +287,11 @@ public:
 
 	void set_sound_effects_volume(int volume);
 
+	int get_max_sound_voices() const
+	{
+		return this->max_sound_voices;
+	}
+
 	bool is_music_enabled() const
 	{
 		return this->music_enabled;
@@ -428,6 +436,7 @@ signals:
 	void changed();
 
 private:
+	QFuture<gsml_data> parsed_file_data; //the preferences file data, if it is being parsed in the background
 	std::string locale;
 	centesimal_int scale_factor = centesimal_int(1);
 	bool fullscreen = true;
@@ -437,6 +446,7 @@ private:
 	wyrmgus::difficulty difficulty;
 	bool sound_effects_enabled = true;
 	int sound_effects_volume = 128;
+	int max_sound_voices = 32; //the maximum amount of sound effects playing at the same time
 	bool music_enabled = true;
 	int music_volume = 128;
 	wyrmgus::hotkey_setup hotkey_setup;
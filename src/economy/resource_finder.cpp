@@ -30,18 +30,24 @@
 
 #include "actions.h"
 #include "economy/resource.h"
+#include "economy/resource_source_index.h"
+#include "map/map.h"
+#include "map/map_layer.h"
 #include "map/tile.h"
 #include "map/tile_flag.h"
 #include "pathfinder/pathfinder.h"
 #include "player/player.h"
+#include "unit/unit.h"
 #include "unit/unit_find.h"
+#include "unit/unit_type.h"
+#include "util/util.h"
 
 namespace wyrmgus {
 
 struct find_resource_cost final
 {
 public:
-	int calculate_modified_distance(int distance, const resource *resource, const CPlayer *worker_player) const
+	static int calculate_modified_distance(int distance, const resource *resource, const CPlayer *worker_player)
 	{
 		//apply modifiers to distance
 
@@ -68,7 +74,7 @@ public:
 
 		this->distance = depot ? depot->MapDistanceTo(tile_pos, z) : 0;
 
-		this->distance = this->calculate_modified_distance(this->distance, resource, worker->Player);
+		this->distance = find_resource_cost::calculate_modified_distance(this->distance, resource, worker->Player);
 
 		this->assigned = 0;
 		this->waiting = 0;
@@ -80,7 +86,7 @@ public:
 
 		this->distance = depot ? mine->MapDistanceTo(*depot) : 0;
 
-		this->distance = this->calculate_modified_distance(this->distance, resource, worker->Player);
+		this->distance = find_resource_cost::calculate_modified_distance(this->distance, resource, worker->Player);
 
 		if (!mine->Type->BoolFlag[CANHARVEST_INDEX].value) {
 			// if it is a deposit rather than a readily-harvestable resource, multiply the distance score
@@ -117,94 +123,319 @@ public:
 		return this->assigned == 0 && this->waiting == 0 && this->distance == 0;
 	}
 
+	unsigned int get_waiting() const
+	{
+		return this->waiting;
+	}
+
+	unsigned int get_distance() const
+	{
+		return this->distance;
+	}
+
 private:
 	unsigned int assigned = 0;
 	unsigned int waiting = 0;
 	unsigned int distance = 0;
 };
 
+struct find_resource_candidate final
+{
+	//whether the candidate should be picked after the other one
+	static bool is_worse(const find_resource_candidate &lhs, const find_resource_candidate &rhs)
+	{
+		if (rhs.cost < lhs.cost) {
+			return true;
+		}
+
+		//for equal costs, prefer the resource closest to the starting point
+		return !(lhs.cost < rhs.cost) && rhs.distance < lhs.distance;
+	}
+
+	find_resource_cost cost;
+	int distance = 0;
+	QRect rect;
+	QPoint resource_pos = QPoint(-1, -1);
+	CUnit *resource_unit = nullptr;
+};
+
 struct find_resource_context final
 {
-	explicit find_resource_context(const resource_finder *finder, find_resource_result &result)
-		: result(result), worker(finder->get_worker()), movemask(finder->get_worker()->Type->MovementMask), max_range(finder->get_range()), resource(finder->get_resource()), depot(finder->get_depot()), ignore_exploration(finder->ignores_exploration()), check_usage(finder->checks_usage()), only_harvestable(finder->includes_only_harvestable()), include_luxury_resources(finder->includes_luxury_resources()), only_same_resource(finder->allows_only_same_resource())
+	explicit find_resource_context(const resource_finder *finder, const CUnit *start_unit, find_resource_result &result)
+		: result(result), worker(finder->get_worker()), map_layer(start_unit->MapLayer), start_rect(start_unit->get_tile_rect()), movemask(finder->get_worker()->Type->MovementMask), max_range(finder->get_range()), resource(finder->get_resource()), depot(finder->get_depot()), ignore_exploration(finder->ignores_exploration()), check_usage(finder->checks_usage()), only_harvestable(finder->includes_only_harvestable()), include_luxury_resources(finder->includes_luxury_resources()), only_same_resource(finder->allows_only_same_resource())
 	{
 		result = find_resource_result();
 		this->best_cost.set_to_max();
+
+		for (const wyrmgus::resource *loop_resource : resource::get_all()) {
+			if (this->is_valid_resource(loop_resource)) {
+				this->valid_resources.push_back(loop_resource);
+			}
+		}
+
+		//the landmasses the worker can reach from the starting point
+		const bool start_pos_passable_only = this->worker != start_unit || start_unit->Container != nullptr;
+		const QRect start_search_rect = this->get_adjacent_rect(this->start_rect);
+		for (int y = start_search_rect.top(); y <= start_search_rect.bottom(); ++y) {
+			for (int x = start_search_rect.left(); x <= start_search_rect.right(); ++x) {
+				const QPoint pos(x, y);
+
+				if ((!start_pos_passable_only && this->start_rect.contains(pos)) || CanMoveToMask(pos, this->movemask, this->map_layer->ID)) {
+					this->start_landmasses.insert(this->map_layer->Field(pos)->get_landmass());
+				}
+			}
+		}
 	}
 
-	VisitResult Visit(TerrainTraversal &terrain_traversal, const Vec2i &pos, const Vec2i &from)
+	void search(resource_source_index *index)
 	{
-		Q_UNUSED(from)
+		//resources are compared by their distance to the depot, so search outwards from it if there is one
+		const QRect center_rect = this->depot != nullptr ? this->depot->get_tile_rect() : this->start_rect;
+		const int center_start_distance = this->get_distance(center_rect);
 
-		const CUnit *worker = this->worker;
+		index->for_each_bucket(center_rect.center(), [&](const QRect &bucket_rect, const int bucket_distance) {
+			//the minimum distance from the center to a resource in the current ring; units may extend out of the bucket they are indexed in, so give some leeway
+			const int min_center_distance = std::max(0, (bucket_distance - 2) * resource_source_index::bucket_size);
 
-		const tile *tile = worker->MapLayer->Field(pos);
+			if (min_center_distance > this->max_range + center_start_distance) {
+				return true;
+			}
 
-		if (!tile->player_info->IsTeamExplored(*worker->Player) && !this->ignore_exploration) {
-			return VisitResult::DeadEnd;
-		}
+			if (this->can_finish(min_center_distance)) {
+				return true;
+			}
 
-		const CPlayer *tile_owner = tile->get_owner();
+			if (this->get_distance(bucket_rect) > this->max_range + resource_source_index::bucket_size) {
+				return false;
+			}
+
+			for (CUnit *unit : index->get_bucket_units(bucket_rect)) {
+				this->check_unit(unit);
+			}
+
+			for (const wyrmgus::resource *valid_resource : this->valid_resources) {
+				if (!index->bucket_has_resource_tiles(bucket_rect, valid_resource)) {
+					continue;
+				}
+
+				for (int y = bucket_rect.top(); y <= bucket_rect.bottom(); ++y) {
+					for (int x = bucket_rect.left(); x <= bucket_rect.right(); ++x) {
+						this->check_tile(QPoint(x, y));
+					}
+				}
+
+				//all resource tiles of the bucket have been checked
+				break;
+			}
+
+			return false;
+		});
+
+		this->settle_candidates();
+	}
+
+	//whether no resource at the given minimum distance from the search center can be better than the current best result
+	bool can_finish(const int min_center_distance)
+	{
+		this->settle_candidates();
+
+		if (this->best_cost.get_waiting() != 0) {
+			return false;
+		}
 
-		if (tile_owner != nullptr && tile_owner != worker->Player && !tile_owner->has_neutral_faction_type() && !worker->Player->has_neutral_faction_type()) {
-			if (this->resource->get_index() != TradeCost || tile_owner->is_enemy_of(*worker->Player)) {
-				return VisitResult::DeadEnd;
+		if (this->depot != nullptr) {
+			for (const wyrmgus::resource *valid_resource : this->valid_resources) {
+				if (static_cast<unsigned int>(find_resource_cost::calculate_modified_distance(min_center_distance, valid_resource, this->worker->Player)) <= this->best_cost.get_distance()) {
+					return false;
+				}
 			}
+
+			return true;
+		}
+
+		//without a depot all resources have the same distance cost, so the one closest to the starting point is preferred
+		return this->best_cost.is_min() && min_center_distance > this->best_distance;
+	}
+
+	void check_tile(const QPoint &pos)
+	{
+		const tile *tile = this->map_layer->Field(pos);
+
+		if (!this->is_valid_resource_tile(tile) || !this->is_accessible_tile(tile)) {
+			return;
 		}
 
-		const int z = worker->MapLayer->ID;
+		const QRect tile_rect(pos, QSize(1, 1));
+		const int distance = this->get_distance(tile_rect);
 
-		if (this->is_valid_resource_tile(tile)) {
-			find_resource_cost cost;
+		if (distance > this->max_range || !this->is_reachable(tile_rect)) {
+			return;
+		}
+
+		find_resource_candidate candidate;
+		candidate.cost.set_from(tile, pos, this->map_layer->ID, this->depot, this->worker);
+		candidate.distance = distance;
+		candidate.rect = tile_rect;
+		candidate.resource_pos = pos;
+
+		this->add_candidate(std::move(candidate));
+	}
+
+	void check_unit(CUnit *mine)
+	{
+		if (!this->is_valid_resource_unit(mine)) {
+			return;
+		}
 
-			cost.set_from(tile, pos, z, this->depot, worker);
+		const QRect mine_rect = mine->get_tile_rect();
 
-			if (cost < this->best_cost) {
-				this->result.resource_pos = pos;
-				this->result.resource_unit = nullptr;
+		//the mine must be visible from at least one of its tiles, and this is needed to prevent neutral factions from trying to build mines in others' territory
+		bool accessible = false;
+		for (int y = mine_rect.top(); y <= mine_rect.bottom() && !accessible; ++y) {
+			for (int x = mine_rect.left(); x <= mine_rect.right(); ++x) {
+				const tile *tile = this->map_layer->Field(x, y);
 
-				if (cost.is_min()) {
-					return VisitResult::Finished;
+				if (!this->is_accessible_tile(tile)) {
+					continue;
 				}
 
-				this->best_cost = cost;
+				const CPlayer *tile_owner = tile->get_owner();
+				if (mine->Type->BoolFlag[CANHARVEST_INDEX].value || tile_owner == nullptr || tile_owner == this->worker->Player) {
+					accessible = true;
+					break;
+				}
 			}
 		}
 
-		CUnit *mine = tile->UnitCache.find([this](const CUnit *unit) {
-			return this->is_valid_resource_unit(unit);
-		});
+		if (!accessible) {
+			return;
+		}
 
-		if (
-			mine != nullptr && mine != result.resource_unit
-			&& (mine->Type->BoolFlag[CANHARVEST_INDEX].value || tile_owner == nullptr || tile_owner == worker->Player) //this is needed to prevent neutral factions from trying to build mines in others' territory
-		) {
-			find_resource_cost cost;
+		const int distance = this->get_distance(mine_rect);
 
-			cost.set_from(mine, this->depot, worker, this->check_usage);
+		if (distance > this->max_range || !this->is_reachable(mine_rect)) {
+			return;
+		}
 
-			if (cost < this->best_cost) {
-				this->result.resource_unit = mine;
-				this->result.resource_pos = QPoint(-1, -1);
+		find_resource_candidate candidate;
+		candidate.cost.set_from(mine, this->depot, this->worker, this->check_usage);
+		candidate.distance = distance;
+		candidate.rect = mine_rect;
+		candidate.resource_unit = mine;
 
-				if (cost.is_min()) {
-					return VisitResult::Finished;
-				}
+		this->add_candidate(std::move(candidate));
+	}
 
-				this->best_cost = cost;
+	void add_candidate(find_resource_candidate &&candidate)
+	{
+		if (!this->is_better(candidate.cost, candidate.distance)) {
+			return;
+		}
+
+		this->candidates.push_back(std::move(candidate));
+		std::push_heap(this->candidates.begin(), this->candidates.end(), find_resource_candidate::is_worse);
+	}
+
+	//check the path to the best candidates, in order, until a reachable one is found and becomes the best result; this is needed because candidates are only checked for reachability locally when added
+	void settle_candidates()
+	{
+		while (!this->candidates.empty()) {
+			std::pop_heap(this->candidates.begin(), this->candidates.end(), find_resource_candidate::is_worse);
+			const find_resource_candidate candidate = std::move(this->candidates.back());
+			this->candidates.pop_back();
+
+			if (!this->has_path_to(candidate.rect)) {
+				continue;
 			}
+
+			this->result.resource_pos = candidate.resource_pos;
+			this->result.resource_unit = candidate.resource_unit;
+			this->best_cost = candidate.cost;
+			this->best_distance = candidate.distance;
+
+			//the remaining candidates are all worse than the one picked
+			this->candidates.clear();
+			return;
+		}
+	}
+
+	bool is_better(const find_resource_cost &cost, const int distance) const
+	{
+		if (cost < this->best_cost) {
+			return true;
 		}
 
-		if (CanMoveToMask(pos, this->movemask, z)) { // reachable
-			if (terrain_traversal.Get(pos) < this->max_range) {
-				return VisitResult::Ok;
-			} else {
-				return VisitResult::DeadEnd;
+		//for equal costs, prefer the resource closest to the starting point
+		return !(this->best_cost < cost) && distance < this->best_distance;
+	}
+
+	bool is_accessible_tile(const tile *tile) const
+	{
+		if (!tile->player_info->IsTeamExplored(*this->worker->Player) && !this->ignore_exploration) {
+			return false;
+		}
+
+		const CPlayer *tile_owner = tile->get_owner();
+
+		if (tile_owner != nullptr && tile_owner != this->worker->Player && !tile_owner->has_neutral_faction_type() && !this->worker->Player->has_neutral_faction_type()) {
+			if (this->resource->get_index() != TradeCost || tile_owner->is_enemy_of(*this->worker->Player)) {
+				return false;
 			}
-		} else {
-			//unreachable
-			return VisitResult::DeadEnd;
 		}
+
+		return true;
+	}
+
+	//whether the worker can reach a tile adjacent to the rect, from the starting point
+	bool is_reachable(const QRect &rect) const
+	{
+		const QRect adjacent_rect = this->get_adjacent_rect(rect);
+
+		for (int y = adjacent_rect.top(); y <= adjacent_rect.bottom(); ++y) {
+			for (int x = adjacent_rect.left(); x <= adjacent_rect.right(); ++x) {
+				const QPoint pos(x, y);
+
+				if (rect.contains(pos)) {
+					continue;
+				}
+
+				if (!CanMoveToMask(pos, this->movemask, this->map_layer->ID)) {
+					continue;
+				}
+
+				if (this->start_landmasses.contains(this->map_layer->Field(pos)->get_landmass())) {
+					return true;
+				}
+			}
+		}
+
+		return false;
+	}
+
+	//whether the worker has a path to the rect; the search is bounded to the area around the worker and the rect, with some leeway for detours
+	bool has_path_to(const QRect &rect) const
+	{
+		const QRect worker_rect = this->worker->GetFirstContainer()->get_tile_rect();
+		const int max_length = square(2 * (find_resource_context::get_distance(worker_rect, rect) + resource_source_index::bucket_size) + 1);
+
+		return PlaceReachable(*this->worker, rect.topLeft(), rect.size(), 0, 1, max_length, this->map_layer->ID, true) != 0;
+	}
+
+	QRect get_adjacent_rect(const QRect &rect) const
+	{
+		return rect.adjusted(-1, -1, 1, 1).intersected(QRect(QPoint(0, 0), this->map_layer->get_size()));
+	}
+
+	int get_distance(const QRect &rect) const
+	{
+		return find_resource_context::get_distance(this->start_rect, rect);
+	}
+
+	static int get_distance(const QRect &rect, const QRect &other_rect)
+	{
+		const int x_distance = std::max({ 0, other_rect.left() - rect.right(), rect.left() - other_rect.right() });
+		const int y_distance = std::max({ 0, other_rect.top() - rect.bottom(), rect.top() - other_rect.bottom() });
+		return std::max(x_distance, y_distance);
 	}
 
 	bool is_valid_resource(const wyrmgus::resource *resource) const
@@ -235,6 +466,8 @@ struct find_resource_context final
 
 	find_resource_result &result;
 	const CUnit *worker = nullptr;
+	const CMapLayer *map_layer = nullptr;
+	const QRect start_rect;
 	const tile_flag movemask = tile_flag::none;
 	int max_range = 0;
 	const wyrmgus::resource *resource = nullptr;
@@ -244,7 +477,11 @@ struct find_resource_context final
 	const bool only_harvestable = false;
 	const bool include_luxury_resources = false;
 	const bool only_same_resource = false;
+	std::vector<const wyrmgus::resource *> valid_resources;
+	std::set<const landmass *> start_landmasses;
 	find_resource_cost best_cost;
+	int best_distance = std::numeric_limits<int>::max();
+	std::vector<find_resource_candidate> candidates; //heap of candidates better than the best result, whose path has not been checked yet
 };
 
 find_resource_result resource_finder::find()
@@ -253,22 +490,11 @@ find_resource_result resource_finder::find()
 		this->depot = FindDepositNearLoc(*this->worker->Player, this->start_unit->tilePos, this->range, this->resource, this->start_unit->MapLayer->ID);
 	}
 
-	TerrainTraversal terrainTraversal;
-
-	terrainTraversal.SetSize(this->start_unit->MapLayer->get_width(), this->start_unit->MapLayer->get_height());
-	terrainTraversal.Init();
-
-	if (this->worker != this->start_unit || this->start_unit->Container != nullptr) {
-		terrainTraversal.push_unit_pos_and_neighbor_if_passable(*this->start_unit, this->worker->Type->MovementMask);
-	} else {
-		terrainTraversal.PushUnitPosAndNeighbor(*this->start_unit);
-	}
-
 	find_resource_result result;
 
-	find_resource_context context(this, result);
+	find_resource_context context(this, this->start_unit, result);
 
-	terrainTraversal.Run(context);
+	context.search(this->start_unit->MapLayer->get_resource_source_index());
 
 	return result;
 }
@@ -0,0 +1,123 @@
+//       _________ __                 __
+//      /   _____//  |_____________ _/  |______     ____  __ __  ______
+//      \_____  \\   __\_  __ \__  \\   __\__  \   / ___\|  |  \/  ___/
+//      /        \|  |  |  | \// __ \|  |  / __ \_/ /_/  >  |  /\___ |
+//     /_______  /|__|  |__|  (____  /__| (____  /\___  /|____//____  >
+//             \/                  \/          \//_____/            \/
+//  ______________________                           ______________________
+//                        T H E   W A R   B E G I N S
+//         Stratagus - A free fantasy real time strategy game engine
+//
+//      (c) Copyright 2026 by Andrettin
+//
+//      This program is free software; you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation; only version 2 of the License.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program; if not, write to the Free Software
+//      Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+//      02111-1307, USA.
+
+#include "stratagus.h"
+
+#include "economy/resource_source_index.h"
+
+#include "economy/resource.h"
+#include "map/map_layer.h"
+#include "map/tile.h"
+#include "unit/unit.h"
+#include "unit/unit_type.h"
+#include "util/vector_util.h"
+
+namespace wyrmgus {
+
+bool resource_source_index::is_resource_source_unit(const CUnit *unit)
+{
+	return unit->Type->get_given_resource() != nullptr || unit->Type->can_produce_a_resource() || unit->GivesResource != 0;
+}
+
+resource_source_index::resource_source_index(const CMapLayer *map_layer) : map_layer(map_layer)
+{
+	this->bucket_columns = (map_layer->get_width() + resource_source_index::bucket_size - 1) / resource_source_index::bucket_size;
+	this->bucket_rows = (map_layer->get_height() + resource_source_index::bucket_size - 1) / resource_source_index::bucket_size;
+	this->buckets.resize(this->bucket_columns * this->bucket_rows);
+}
+
+void resource_source_index::add_unit(CUnit *unit)
+{
+	if (!resource_source_index::is_resource_source_unit(unit)) {
+		return;
+	}
+
+	bucket &bucket = this->buckets[this->get_bucket_index(unit->tilePos)];
+
+	if (!vector::contains(bucket.units, unit)) {
+		bucket.units.push_back(unit);
+	}
+}
+
+void resource_source_index::remove_unit(CUnit *unit)
+{
+	bucket &bucket = this->buckets[this->get_bucket_index(unit->tilePos)];
+
+	std::erase(bucket.units, unit);
+}
+
+void resource_source_index::on_tile_changed(const QPoint &tile_pos)
+{
+	this->buckets[this->get_bucket_index(tile_pos)].resource_tile_counts_dirty = true;
+}
+
+bool resource_source_index::bucket_has_resource_tiles(const QRect &bucket_rect, const resource *resource)
+{
+	bucket &bucket = this->buckets[this->get_bucket_index(bucket_rect.topLeft())];
+
+	if (bucket.resource_tile_counts_dirty) {
+		this->update_resource_tile_counts(bucket, bucket_rect);
+	}
+
+	return bucket.resource_tile_counts[resource->get_index()] > 0;
+}
+
+int resource_source_index::get_width() const
+{
+	return this->map_layer->get_width();
+}
+
+int resource_source_index::get_height() const
+{
+	return this->map_layer->get_height();
+}
+
+QRect resource_source_index::get_bucket_rect(const QPoint &bucket_pos) const
+{
+	const QPoint top_left(bucket_pos.x() * resource_source_index::bucket_size, bucket_pos.y() * resource_source_index::bucket_size);
+	const QPoint bottom_right(std::min(top_left.x() + resource_source_index::bucket_size, this->get_width()) - 1, std::min(top_left.y() + resource_source_index::bucket_size, this->get_height()) - 1);
+
+	return QRect(top_left, bottom_right);
+}
+
+void resource_source_index::update_resource_tile_counts(bucket &bucket, const QRect &bucket_rect)
+{
+	bucket.resource_tile_counts.assign(resource::get_all().size(), 0);
+
+	for (int y = bucket_rect.top(); y <= bucket_rect.bottom(); ++y) {
+		for (int x = bucket_rect.left(); x <= bucket_rect.right(); ++x) {
+			const resource *tile_resource = this->map_layer->Field(x, y)->get_resource();
+
+			if (tile_resource != nullptr) {
+				++bucket.resource_tile_counts[tile_resource->get_index()];
+			}
+		}
+	}
+
+	bucket.resource_tile_counts_dirty = false;
+}
+
+}
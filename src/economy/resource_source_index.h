@@ -0,0 +1,122 @@
+//       _________ __                 __
+//      /   _____//  |_____________ _/  |______     ____  __ __  ______
+//      \_____  \\   __\_  __ \__  \\   __\__  \   / ___\|  |  \/  ___/
+//      /        \|  |  |  | \// __ \|  |  / __ \_/ /_/  >  |  /\___ |
+//     /_______  /|__|  |__|  (____  /__| (____  /\___  /|____//____  >
+//             \/                  \/          \//_____/            \/
+//  ______________________                           ______________________
+//                        T H E   W A R   B E G I N S
+//         Stratagus - A free fantasy real time strategy game engine
+//
+//      (c) Copyright 2026 by Andrettin
+//
+//      This program is free software; you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation; only version 2 of the License.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program; if not, write to the Free Software
+//      Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+//      02111-1307, USA.
+
+#pragma once
+
+class CMapLayer;
+class CUnit;
+
+namespace wyrmgus {
+
+class resource;
+
+//a spatial index of the resource sources (resource units and resource tiles) of a map layer, grouped in buckets of tiles, so that resources can be found without flooding the map
+class resource_source_index final
+{
+public:
+	static constexpr int bucket_size = 16; //the width and height of each bucket, in tiles
+
+	static bool is_resource_source_unit(const CUnit *unit);
+
+	explicit resource_source_index(const CMapLayer *map_layer);
+
+	void add_unit(CUnit *unit);
+	void remove_unit(CUnit *unit);
+
+	//mark a tile's resource as having changed, so that its bucket's resource tile counts are recalculated when next needed
+	void on_tile_changed(const QPoint &tile_pos);
+
+	//call a function for each bucket, in rings of increasing distance from the bucket containing the given position; the function is given the ring's distance in buckets, and if it returns true, the iteration stops
+	template <typename function_type>
+	void for_each_bucket(const QPoint &center_tile_pos, const function_type &function)
+	{
+		const QPoint center_bucket_pos = this->get_bucket_pos(center_tile_pos);
+		const int max_bucket_distance = std::max(this->bucket_columns, this->bucket_rows);
+
+		for (int bucket_distance = 0; bucket_distance <= max_bucket_distance; ++bucket_distance) {
+			for (int y = center_bucket_pos.y() - bucket_distance; y <= center_bucket_pos.y() + bucket_distance; ++y) {
+				if (y < 0 || y >= this->bucket_rows) {
+					continue;
+				}
+
+				//only the borders of the ring are at the current distance
+				const bool full_row = (y == center_bucket_pos.y() - bucket_distance || y == center_bucket_pos.y() + bucket_distance);
+				const int x_step = full_row ? 1 : bucket_distance * 2;
+
+				for (int x = center_bucket_pos.x() - bucket_distance; x <= center_bucket_pos.x() + bucket_distance; x += x_step) {
+					if (x < 0 || x >= this->bucket_columns) {
+						continue;
+					}
+
+					if (function(this->get_bucket_rect(QPoint(x, y)), bucket_distance)) {
+						return;
+					}
+				}
+			}
+		}
+	}
+
+	const std::vector<CUnit *> &get_bucket_units(const QRect &bucket_rect) const
+	{
+		return this->buckets[this->get_bucket_index(bucket_rect.topLeft())].units;
+	}
+
+	bool bucket_has_resource_tiles(const QRect &bucket_rect, const resource *resource);
+
+private:
+	struct bucket final
+	{
+		std::vector<CUnit *> units;
+		std::vector<int> resource_tile_counts; //indexed by resource index
+		bool resource_tile_counts_dirty = true;
+	};
+
+	int get_width() const;
+	int get_height() const;
+
+	QPoint get_bucket_pos(const QPoint &tile_pos) const
+	{
+		return QPoint(std::clamp(tile_pos.x(), 0, this->get_width() - 1) / resource_source_index::bucket_size, std::clamp(tile_pos.y(), 0, this->get_height() - 1) / resource_source_index::bucket_size);
+	}
+
+	size_t get_bucket_index(const QPoint &tile_pos) const
+	{
+		const QPoint bucket_pos = this->get_bucket_pos(tile_pos);
+		return static_cast<size_t>(bucket_pos.x() + bucket_pos.y() * this->bucket_columns);
+	}
+
+	QRect get_bucket_rect(const QPoint &bucket_pos) const;
+
+	void update_resource_tile_counts(bucket &bucket, const QRect &bucket_rect);
+
+private:
+	const CMapLayer *map_layer = nullptr;
+	int bucket_columns = 0;
+	int bucket_rows = 0;
+	std::vector<bucket> buckets;
+};
+
+}
@@ -98,6 +98,7 @@
 #include "sound/music_type.h"
 #include "sound/sound.h"
 #include "sound/sound_server.h"
+#include "spell/autocast_scheduler.h"
 #include "spell/spell.h"
 #include "time/calendar.h"
 #include "translator.h"
@@ -1666,6 +1667,7 @@ void CleanGame()
 	CleanAi();
 	CleanGroups();
 	CleanMissiles();
+	autocast_scheduler::get()->clear();
 	CleanUnits();
 	CleanSelections();
 	CMap::get()->Clean();
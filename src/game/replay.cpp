@@ -46,6 +46,7 @@
 //Wyrmgus start
 #include "quest/quest.h"
 //Wyrmgus end
+#include "results.h"
 #include "script.h"
 #include "settings.h"
 #include "spell/spell.h"
@@ -57,8 +58,10 @@
 #include "unit/unit_manager.h"
 #include "unit/unit_type.h"
 #include "util/assert_util.h"
+#include "util/log_util.h"
 #include "util/path_util.h"
 #include "util/random.h"
+#include "util/stage_timer.h"
 #include "version.h"
 
 class LogEntry
@@ -78,6 +81,17 @@ public:
 	std::unique_ptr<LogEntry> Next;
 };
 
+/**
+**  Sync state recorded at a given cycle, to detect when a replay gets out of sync
+*/
+class ReplaySyncPoint final
+{
+public:
+	unsigned long GameCycle = 0;
+	unsigned SyncHash = 0;
+	unsigned SyncRandSeed = 0;
+};
+
 /**
 **  Multiplayer Player definition
 */
@@ -139,8 +153,11 @@ public:
 	int Engine[3];
 	int Network[3];
 	std::unique_ptr<LogEntry> Commands;
+	std::vector<ReplaySyncPoint> SyncPoints;
 };
 
+static constexpr unsigned long ReplaySyncInterval = CYCLES_PER_SECOND; /// Cycles between recorded sync points
+
 bool CommandLogDisabled;           /// True if command log is off
 ReplayType ReplayGameType;         /// Replay game type
 static bool DisabledLog;           /// Disabled log for replay
@@ -149,6 +166,9 @@ static unsigned long NextLogCycle; /// Next log cycle number
 static int InitReplay;             /// Initialize replay
 static std::unique_ptr<FullReplay> CurrentReplay;
 static LogEntry *ReplayStep;
+static size_t NextSyncPointIndex;  /// Index of the next sync point to check in the replay
+static unsigned long ReplayDesyncCycle = ~0UL; /// First cycle in which the replay got out of sync
+static unsigned long LastReplayCycle; /// Last cycle run of the replay
 
 //----------------------------------------------------------------------------
 // Log commands
@@ -295,6 +315,14 @@ static void PrintLogCommand(const LogEntry &log, CFile &file)
 	file.printf("SyncRandSeed = %d } )\n", (signed)log.SyncRandSeed);
 }
 
+static void PrintSyncPoint(const ReplaySyncPoint &sync_point, CFile &file)
+{
+	file.printf("ReplaySync( { ");
+	file.printf("GameCycle = %lu, ", sync_point.GameCycle);
+	file.printf("SyncHash = %d, ", (signed)sync_point.SyncHash);
+	file.printf("SyncRandSeed = %d } )\n", (signed)sync_point.SyncRandSeed);
+}
+
 /**
 **  Output the FullReplay list to file
 **
@@ -361,6 +389,9 @@ static void SaveFullLog(CFile &file)
 		PrintLogCommand(*log, file);
 		log = log->Next.get();
 	}
+	for (const ReplaySyncPoint &sync_point : CurrentReplay->SyncPoints) {
+		PrintSyncPoint(sync_point, file);
+	}
 }
 
 /**
@@ -547,6 +578,40 @@ static int CclLog(lua_State *l)
 	return 0;
 }
 
+/**
+** Parse sync point
+*/
+static int CclReplaySync(lua_State *l)
+{
+	LuaCheckArgs(l, 1);
+	if (!lua_istable(l, 1)) {
+		LuaError(l, "incorrect argument");
+	}
+
+	assert_throw(CurrentReplay != nullptr);
+
+	ReplaySyncPoint sync_point;
+
+	lua_pushnil(l);
+	while (lua_next(l, 1)) {
+		const char *value = LuaToString(l, -2);
+		if (!strcmp(value, "GameCycle")) {
+			sync_point.GameCycle = LuaToNumber(l, -1);
+		} else if (!strcmp(value, "SyncHash")) {
+			sync_point.SyncHash = LuaToUnsignedNumber(l, -1);
+		} else if (!strcmp(value, "SyncRandSeed")) {
+			sync_point.SyncRandSeed = LuaToUnsignedNumber(l, -1);
+		} else {
+			LuaError(l, "Unsupported key: %s" _C_ value);
+		}
+		lua_pop(l, 1);
+	}
+
+	CurrentReplay->SyncPoints.push_back(std::move(sync_point));
+
+	return 0;
+}
+
 /**
 ** Parse replay-log
 */
@@ -712,6 +777,10 @@ int LoadReplay(const std::filesystem::path &filepath)
 	LuaLoadFile(path::to_string(filepath));
 
 	NextLogCycle = ~0UL;
+	//kept after the game is cleaned, so that the replay verification can report them
+	NextSyncPointIndex = 0;
+	ReplayDesyncCycle = ~0UL;
+	LastReplayCycle = 0;
 	if (!CommandLogDisabled) {
 		CommandLogDisabled = true;
 		DisabledLog = true;
@@ -783,6 +852,17 @@ static void DoNextReplay()
 	assert_throw(unitSlot == -1 || ReplayStep->UnitIdent == unit->Type->get_identifier());
 
 	if (wyrmgus::random::get()->get_seed() != ReplayStep->SyncRandSeed) {
+		if (ReplayStep->SyncRandSeed && ReplayDesyncCycle == ~0UL) {
+			ReplayDesyncCycle = GameCycle;
+		}
+
+		if (parameters::get()->is_replay_verification()) {
+			//stop replaying, the verification will report the desync
+			ReplayStep = nullptr;
+			NextLogCycle = ~0UL;
+			return;
+		}
+
 #ifdef DEBUG
 		if (!ReplayStep->SyncRandSeed) {
 			// Replay without the 'sync info
@@ -927,6 +1007,7 @@ static void ReplayEachCycle()
 		}
 		ReplayStep = CurrentReplay->Commands.get();
 		NextLogCycle = (ReplayStep ? ReplayStep->GameCycle : ~0UL);
+		NextSyncPointIndex = 0;
 		InitReplay = 0;
 	}
 
@@ -970,6 +1051,65 @@ void MultiPlayerReplayEachCycle()
 	}
 }
 
+/**
+**  Record the sync state into the log each sync interval, or check it against the one recorded in the replay
+*/
+void ReplaySyncEachCycle()
+{
+	if (IsReplayGame()) {
+		if (!CurrentReplay) {
+			return;
+		}
+
+		LastReplayCycle = GameCycle;
+
+		const std::vector<ReplaySyncPoint> &sync_points = CurrentReplay->SyncPoints;
+
+		while (NextSyncPointIndex < sync_points.size() && sync_points[NextSyncPointIndex].GameCycle <= GameCycle) {
+			const ReplaySyncPoint &sync_point = sync_points[NextSyncPointIndex];
+			++NextSyncPointIndex;
+
+			if (sync_point.GameCycle != GameCycle) {
+				continue;
+			}
+
+			if ((sync_point.SyncHash != SyncHash || sync_point.SyncRandSeed != wyrmgus::random::get()->get_seed()) && ReplayDesyncCycle == ~0UL) {
+				ReplayDesyncCycle = GameCycle;
+				DebugPrint("Replay out of sync in cycle %lu: sync hash %u != %u, seed %u != %u\n" _C_ GameCycle _C_ SyncHash _C_ sync_point.SyncHash _C_ wyrmgus::random::get()->get_seed() _C_ sync_point.SyncRandSeed);
+			}
+		}
+
+		if (parameters::get()->is_replay_verification() && GameRunning) {
+			const bool replay_finished = !InitReplay && ReplayStep == nullptr && NextSyncPointIndex >= sync_points.size();
+			if (replay_finished || ReplayDesyncCycle != ~0UL) {
+				StopGame(GameNoResult);
+			}
+		}
+		return;
+	}
+
+	if (CommandLogDisabled || (GameCycle % ReplaySyncInterval) != 0) {
+		return;
+	}
+
+	//ensure the log file and replay header exist
+	CommandLog(nullptr, nullptr, 0, -1, -1, nullptr, nullptr, -1);
+
+	if (!LogFile || !CurrentReplay) {
+		return;
+	}
+
+	ReplaySyncPoint sync_point;
+	sync_point.GameCycle = GameCycle;
+	sync_point.SyncHash = SyncHash;
+	sync_point.SyncRandSeed = wyrmgus::random::get()->get_seed();
+
+	PrintSyncPoint(sync_point, *LogFile);
+	LogFile->flush();
+
+	CurrentReplay->SyncPoints.push_back(std::move(sync_point));
+}
+
 /**
 **  Save the replay
 **
@@ -1031,6 +1171,27 @@ QCoro::Task<void> StartReplay(const std::filesystem::path &filepath, const bool
 	co_await StartMap(CurrentMapPath, false);
 }
 
+QCoro::Task<int> VerifyReplay(const std::filesystem::path &filepath)
+{
+	const stage_timer timer;
+
+	co_await StartReplay(filepath, false);
+
+	const long long elapsed_ms = timer.get_elapsed_ms();
+
+	const unsigned long desync_cycle = ReplayDesyncCycle;
+	const unsigned long cycles = LastReplayCycle;
+	const size_t checked_sync_points = NextSyncPointIndex;
+
+	if (desync_cycle != ~0UL) {
+		log::log_error("Replay \"" + path::to_string(filepath) + "\" got out of sync in game cycle " + std::to_string(desync_cycle) + ".");
+		co_return EXIT_FAILURE;
+	}
+
+	fprintf(stdout, "Replay \"%s\" verified: %lu cycles, %u sync points checked, %lld ms.\n", path::to_string(filepath).c_str(), cycles, static_cast<unsigned>(checked_sync_points), elapsed_ms);
+	co_return EXIT_SUCCESS;
+}
+
 /**
 **  Register Ccl functions with lua
 */
@@ -1038,4 +1199,5 @@ void ReplayCclRegister()
 {
 	lua_register(Lua, "Log", CclLog);
 	lua_register(Lua, "ReplayLog", CclReplayLog);
+	lua_register(Lua, "ReplaySync", CclReplaySync);
 }
@@ -47,6 +47,8 @@ extern void CommandLog(const char *action, const CUnit *unit, int flush,
 extern void SinglePlayerReplayEachCycle();
 /// Replay user commands from log each cycle, multiplayer games
 extern void MultiPlayerReplayEachCycle();
+/// Record the sync state into the log, or check it against the replay, at each sync interval
+extern void ReplaySyncEachCycle();
 /// Load replay
 extern int LoadReplay(const std::filesystem::path &filepath);
 /// End logging
@@ -59,5 +61,9 @@ extern void SaveReplayList(CFile &file);
 [[nodiscard]]
 extern QCoro::Task<void> StartReplay(const std::filesystem::path &filepath, const bool reveal);
 
+/// Run a replay headlessly, and return the exit code for whether it stayed in sync
+[[nodiscard]]
+extern QCoro::Task<int> VerifyReplay(const std::filesystem::path &filepath);
+
 /// Register ccl functions related to network
 extern void ReplayCclRegister();
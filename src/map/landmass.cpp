@@ -31,7 +31,6 @@
 #include "database/gsml_data.h"
 #include "map/map.h"
 #include "map/world.h"
-#include "util/vector_util.h"
 
 namespace wyrmgus {
 
@@ -82,11 +81,6 @@ gsml_data landmass::to_gsml_data() const
 	return data;
 }
 
-bool landmass::borders_landmass(const landmass *landmass) const
-{
-	return vector::contains(this->border_landmasses, landmass);
-}
-
 bool landmass::borders_landmass_secondarily(const landmass *landmass) const
 {
 	for (const wyrmgus::landmass *border_landmass : this->get_border_landmasses()) {
@@ -57,11 +57,15 @@ public:
 		return this->border_landmasses;
 	}
 
-	bool borders_landmass(const landmass *landmass) const;
+	bool borders_landmass(const landmass *landmass) const
+	{
+		return this->border_landmass_set.contains(landmass);
+	}
 
 	void add_border_landmass(const landmass *landmass)
 	{
 		this->border_landmasses.push_back(landmass);
+		this->border_landmass_set.insert(landmass);
 	}
 
 	bool borders_landmass_secondarily(const landmass *landmass) const;
@@ -74,6 +78,7 @@ public:
 private:
 	const size_t index = 0;
 	std::vector<const landmass *> border_landmasses; //"landmasses" which border this one
+	std::set<const landmass *> border_landmass_set; //the same landmasses, for fast lookup
 	const wyrmgus::world *world = nullptr; //the world to which this landmass belongs
 };
 
@@ -33,6 +33,7 @@
 #include "database/defines.h"
 #include "database/gsml_parser.h"
 #include "database/preferences.h"
+#include "economy/resource_source_index.h"
 //Wyrmgus start
 #include "editor.h"
 //Wyrmgus end
@@ -49,6 +50,7 @@
 #include "map/map_template.h"
 #include "map/minimap.h"
 #include "map/nearby_sight_unmarker.h"
+#include "map/random_position_sampler.h"
 #include "map/site.h"
 #include "map/site_container.h"
 #include "map/site_game_data.h"
@@ -96,6 +98,7 @@
 #include "util/rect_util.h"
 #include "util/set_util.h"
 #include "util/size_util.h"
+#include "util/stage_timer.h"
 #include "util/string_util.h"
 #include "util/util.h"
 #include "util/vector_random_util.h"
@@ -336,20 +339,13 @@ QPoint CMap::generate_unit_location(const wyrmgus::unit_type *unit_type, const C
 
 	const unit_stats &stats = player != nullptr ? unit_type->Stats[player->get_index()] : unit_type->DefaultStat;
 
-	std::vector<QPoint> potential_positions;
-
 	const int max_x_offset = (max_pos.x() - (unit_type->get_tile_width() - 1)) - min_pos.x();
 	const int max_y_offset = (max_pos.y() - (unit_type->get_tile_height() - 1)) - min_pos.y();
-	potential_positions.reserve(max_x_offset * max_y_offset);
 
-	for (int x_offset = 0; x_offset <= max_x_offset; ++x_offset) {
-		for (int y_offset = 0; y_offset <= max_y_offset; ++y_offset) {
-			potential_positions.emplace_back(min_pos.x() + x_offset, min_pos.y() + y_offset);
-		}
-	}
+	random_position_sampler position_sampler(QRect(min_pos, min_pos + QPoint(max_x_offset, max_y_offset)));
 	
-	while (!potential_positions.empty()) {
-		random_pos = vector::take_random(potential_positions);
+	while (!position_sampler.is_empty()) {
+		random_pos = position_sampler.take_random();
 		
 		if (!this->Info->IsPointOnMap(random_pos, z) || (this->is_point_in_a_subtemplate_area(random_pos, z) && GameCycle == 0)) {
 			continue;
@@ -953,34 +949,21 @@ bool CMap::TileHasUnitsIncompatibleWithTerrain(const Vec2i &pos, const wyrmgus::
 
 bool CMap::is_point_in_a_subtemplate_area(const QPoint &pos, const int z) const
 {
-	for (const auto &kv_pair : this->MapLayers[z]->subtemplate_areas) {
-		const map_template *subtemplate = kv_pair.first;
-		const QRect &subtemplate_rect = kv_pair.second;
-		if (subtemplate_rect.contains(pos) && subtemplate->is_map_pos_usable(pos)) {
-			return true;
-		}
-	}
-
-	return false;
+	return this->MapLayers[z]->get_tile_subtemplate(pos) != nullptr;
 }
 
 bool CMap::is_rect_in_a_subtemplate_area(const QRect &rect, const int z) const
 {
-	for (const auto &kv_pair : this->MapLayers[z]->subtemplate_areas) {
-		const map_template *subtemplate = kv_pair.first;
-		const QRect &subtemplate_rect = kv_pair.second;
-
-		if (!rect.intersects(subtemplate_rect)) {
-			continue;
-		}
+	const CMapLayer *map_layer = this->MapLayers[z].get();
 
-		for (int x = rect.x(); x <= rect.right(); ++x) {
-			for (int y = rect.y(); y <= rect.bottom(); ++y) {
-				const QPoint tile_pos(x, y);
+	if (map_layer->subtemplate_areas.empty()) {
+		return false;
+	}
 
-				if (subtemplate->is_map_pos_usable(tile_pos)) {
-					return true;
-				}
+	for (int x = rect.x(); x <= rect.right(); ++x) {
+		for (int y = rect.y(); y <= rect.bottom(); ++y) {
+			if (map_layer->get_tile_subtemplate(QPoint(x, y)) != nullptr) {
+				return true;
 			}
 		}
 	}
@@ -1433,11 +1416,12 @@ void PreprocessMap()
 				CMap::get()->apply_wall_history();
 			}
 
+			CMap::get()->calculate_landmasses(z);
+
 			for (int ix = 0; ix < CMap::get()->Info->MapWidths[z]; ++ix) {
 				for (int iy = 0; iy < CMap::get()->Info->MapHeights[z]; ++iy) {
 					const QPoint tile_pos(ix, iy);
 					wyrmgus::tile &mf = *CMap::get()->Field(tile_pos, z);
-					CMap::get()->CalculateTileLandmass(tile_pos, z);
 					CMap::get()->CalculateTileOwnershipTransition(tile_pos, z);
 					mf.bump_incompatible_units();
 					mf.UpdateSeenTile();
@@ -2144,6 +2128,7 @@ void CMap::SetTileTerrain(const QPoint &pos, const terrain_type *terrain, const
 		const size_t old_overlay_transition_count = tile->OverlayTransitionTiles.size();
 
 		tile->SetTerrain(terrain);
+		map_layer->get_resource_source_index()->on_tile_changed(pos);
 
 		if (terrain->is_overlay()) {
 			//remove decorations if the overlay terrain has changed
@@ -2247,6 +2232,7 @@ void CMap::RemoveTileOverlayTerrain(const QPoint &pos, const int z)
 	const size_t old_overlay_transition_count = tile->OverlayTransitionTiles.size();
 
 	tile->RemoveOverlayTerrain();
+	map_layer->get_resource_source_index()->on_tile_changed(pos);
 	
 	this->calculate_tile_transitions(pos, true, z);
 	
@@ -2320,6 +2306,7 @@ void CMap::SetOverlayTerrainDestroyed(const QPoint &pos, const bool destroyed, c
 		}
 
 		tile->SetOverlayTerrainDestroyed(destroyed);
+		map_layer->get_resource_source_index()->on_tile_changed(pos);
 
 		if (destroyed) {
 			if (tile->get_overlay_terrain()->has_flag(tile_flag::tree)) {
@@ -2771,71 +2758,156 @@ void CMap::calculate_tile_transitions(const QPoint &pos, const bool overlay, con
 	}
 }
 
-void CMap::CalculateTileLandmass(const Vec2i &pos, int z)
+void CMap::calculate_landmasses(const int z)
 {
-	if (!this->Info->IsPointOnMap(pos, z)) {
-		return;
-	}
-	
 	if (CEditor::get()->is_running()) { //no need to assign landmasses while in the editor
 		return;
 	}
-	
-	wyrmgus::tile &mf = *this->Field(pos, z);
 
-	if (mf.get_landmass() != nullptr) {
-		return; //already calculated
+	const int width = this->Info->MapWidths[z];
+	const int height = this->Info->MapHeights[z];
+
+	//tiles which have the same landmass type and are adjacent to each other belong to the same landmass
+	static constexpr int no_landmass_type = -1;
+	std::vector<int> tile_landmass_types(width * height, no_landmass_type);
+
+	for (int y = 0; y < height; ++y) {
+		for (int x = 0; x < width; ++x) {
+			const wyrmgus::tile *tile = this->Field(x, y, z);
+
+			if (tile->get_landmass() != nullptr || tile->has_flag(tile_flag::space)) {
+				//already calculated, or a space tile, which has no landmass
+				continue;
+			}
+
+			const bool is_water = tile->has_flag(tile_flag::water_allowed) || tile->has_flag(tile_flag::coast_allowed);
+			const bool is_space_cliff = tile->has_flag(tile_flag::space_cliff);
+			tile_landmass_types[x + y * width] = (is_water ? 1 : 0) | (is_space_cliff ? 2 : 0);
+		}
 	}
-	
-	const bool is_space = mf.has_flag(tile_flag::space);
 
-	if (is_space) {
-		return; //no landmass for space tiles
+	//label the connected tiles with a union-find structure, instead of flood-filling from each tile
+	std::vector<int> parent_indices(width * height);
+	for (size_t i = 0; i < parent_indices.size(); ++i) {
+		parent_indices[i] = static_cast<int>(i);
 	}
 
-	const bool is_water = mf.has_flag(tile_flag::water_allowed) || mf.has_flag(tile_flag::coast_allowed);
-	const bool is_space_cliff = mf.has_flag(tile_flag::space_cliff);
+	const auto find_root = [&parent_indices](int index) {
+		while (parent_indices[index] != index) {
+			parent_indices[index] = parent_indices[parent_indices[index]];
+			index = parent_indices[index];
+		}
 
-	//doesn't have a landmass, and hasn't inherited one from another tile, so add a new one
-	const size_t landmass_index = this->landmasses.size();
-	const world *landmass_world = this->calculate_pos_world(pos, z, is_space_cliff);
-	this->landmasses.push_back(std::make_unique<landmass>(landmass_index, landmass_world));
-	mf.set_landmass(this->landmasses.back().get());
+		return index;
+	};
 
-	//now, spread the new landmass to neighboring land tiles
-	std::vector<Vec2i> landmass_tiles;
-	landmass_tiles.push_back(pos);
+	for (int y = 0; y < height; ++y) {
+		for (int x = 0; x < width; ++x) {
+			const int index = x + y * width;
+			const int landmass_type = tile_landmass_types[index];
 
-	for (size_t i = 0; i < landmass_tiles.size(); ++i) {
-		for (int x_offset = -1; x_offset <= 1; ++x_offset) {
-			for (int y_offset = -1; y_offset <= 1; ++y_offset) {
-				if (x_offset != 0 || y_offset != 0) {
-					Vec2i adjacent_pos(landmass_tiles[i].x + x_offset, landmass_tiles[i].y + y_offset);
+			if (landmass_type == no_landmass_type) {
+				continue;
+			}
 
-					if (this->Info->IsPointOnMap(adjacent_pos, z)) {
-						wyrmgus::tile &adjacent_mf = *this->Field(adjacent_pos, z);
+			//only the adjacent tiles which have already been visited need to be checked: west, northwest, north and northeast
+			static constexpr std::array<QPoint, 4> previous_offsets = { QPoint(-1, 0), QPoint(-1, -1), QPoint(0, -1), QPoint(1, -1) };
 
-						const bool adjacent_is_space = adjacent_mf.has_flag(tile_flag::space);
+			for (const QPoint &offset : previous_offsets) {
+				const int adjacent_x = x + offset.x();
+				const int adjacent_y = y + offset.y();
 
-						if (adjacent_is_space) {
-							continue;
-						}
+				if (adjacent_x < 0 || adjacent_y < 0 || adjacent_x >= width) {
+					continue;
+				}
 
-						const bool adjacent_is_water = adjacent_mf.has_flag(tile_flag::water_allowed) || adjacent_mf.has_flag(tile_flag::coast_allowed);
-						const bool adjacent_is_space_cliff = adjacent_mf.has_flag(tile_flag::space_cliff);
-						const bool adjacent_is_compatible = (adjacent_is_water == is_water) && (adjacent_is_space_cliff == is_space_cliff);
-									
-						if (adjacent_is_compatible) {
-							if (adjacent_mf.get_landmass() == nullptr) {
-								adjacent_mf.set_landmass(mf.get_landmass());
-								landmass_tiles.push_back(adjacent_pos);
-							}
-						} else {
-							if (adjacent_mf.get_landmass() != nullptr && !mf.get_landmass()->borders_landmass(adjacent_mf.get_landmass())) {
-								mf.get_landmass()->add_border_landmass(adjacent_mf.get_landmass());
-								adjacent_mf.get_landmass()->add_border_landmass(mf.get_landmass());
-							}
-						}
+				const int adjacent_index = adjacent_x + adjacent_y * width;
+
+				if (tile_landmass_types[adjacent_index] != landmass_type) {
+					continue;
+				}
+
+				const int root = find_root(index);
+				const int adjacent_root = find_root(adjacent_index);
+
+				if (root != adjacent_root) {
+					parent_indices[std::max(root, adjacent_root)] = std::min(root, adjacent_root);
+				}
+			}
+		}
+	}
+
+	//create the landmasses in column order, so that their indices are the same as with a flood fill going through the tiles in that order
+	std::vector<landmass *> root_landmasses(width * height, nullptr);
+
+	for (int x = 0; x < width; ++x) {
+		for (int y = 0; y < height; ++y) {
+			const int index = x + y * width;
+			const int landmass_type = tile_landmass_types[index];
+
+			if (landmass_type == no_landmass_type) {
+				continue;
+			}
+
+			const int root = find_root(index);
+			landmass *tile_landmass = root_landmasses[root];
+
+			if (tile_landmass == nullptr) {
+				const size_t landmass_index = this->landmasses.size();
+				const bool is_space_cliff = (landmass_type & 2) != 0;
+				const world *landmass_world = this->calculate_pos_world(QPoint(x, y), z, is_space_cliff);
+				this->landmasses.push_back(std::make_unique<landmass>(landmass_index, landmass_world));
+				tile_landmass = this->landmasses.back().get();
+				root_landmasses[root] = tile_landmass;
+			}
+
+			this->Field(x, y, z)->set_landmass(tile_landmass);
+		}
+	}
+
+	//record which landmasses border each other
+	for (int x = 0; x < width; ++x) {
+		for (int y = 0; y < height; ++y) {
+			const int index = x + y * width;
+			const int landmass_type = tile_landmass_types[index];
+
+			if (landmass_type == no_landmass_type) {
+				continue;
+			}
+
+			landmass *tile_landmass = root_landmasses[find_root(index)];
+
+			for (int x_offset = -1; x_offset <= 1; ++x_offset) {
+				for (int y_offset = -1; y_offset <= 1; ++y_offset) {
+					if (x_offset == 0 && y_offset == 0) {
+						continue;
+					}
+
+					const QPoint adjacent_pos(x + x_offset, y + y_offset);
+
+					if (!this->Info->IsPointOnMap(adjacent_pos, z)) {
+						continue;
+					}
+
+					const wyrmgus::tile *adjacent_tile = this->Field(adjacent_pos, z);
+
+					if (adjacent_tile->has_flag(tile_flag::space)) {
+						continue;
+					}
+
+					const bool adjacent_is_water = adjacent_tile->has_flag(tile_flag::water_allowed) || adjacent_tile->has_flag(tile_flag::coast_allowed);
+					const bool adjacent_is_space_cliff = adjacent_tile->has_flag(tile_flag::space_cliff);
+					const int adjacent_landmass_type = (adjacent_is_water ? 1 : 0) | (adjacent_is_space_cliff ? 2 : 0);
+
+					if (adjacent_landmass_type == landmass_type) {
+						continue;
+					}
+
+					landmass *adjacent_landmass = adjacent_tile->get_landmass();
+
+					if (adjacent_landmass != nullptr && !tile_landmass->borders_landmass(adjacent_landmass)) {
+						tile_landmass->add_border_landmass(adjacent_landmass);
+						adjacent_landmass->add_border_landmass(tile_landmass);
 					}
 				}
 			}
@@ -2905,16 +2977,69 @@ void CMap::CalculateTileOwnershipTransition(const Vec2i &pos, int z)
 	}
 }
 
+//the tiles in an area which need to be checked (again) by an iterative tile adjustment pass
+//a tile only needs to be checked again if it or one of its adjacent tiles has changed since it was last checked, as otherwise the check would give the same result; skipping the other tiles while keeping the iteration order gives the same result as checking every tile in every iteration
+class tile_recheck_marks final
+{
+public:
+	explicit tile_recheck_marks(const QRect &rect) : rect(rect), marks(rect.isEmpty() ? 0 : rect.width() * rect.height(), true)
+	{
+	}
+
+	//get whether the tile needs to be checked, and unmark it
+	bool take(const QPoint &tile_pos)
+	{
+		const size_t index = this->get_index(tile_pos);
+		const bool marked = this->marks[index];
+		this->marks[index] = false;
+		return marked;
+	}
+
+	//mark a changed tile and its adjacent tiles to be checked
+	void mark_changed(const QPoint &tile_pos)
+	{
+		for (int x_offset = -1; x_offset <= 1; ++x_offset) {
+			for (int y_offset = -1; y_offset <= 1; ++y_offset) {
+				const QPoint marked_pos(tile_pos.x() + x_offset, tile_pos.y() + y_offset);
+
+				if (this->rect.contains(marked_pos)) {
+					this->marks[this->get_index(marked_pos)] = true;
+				}
+			}
+		}
+	}
+
+private:
+	size_t get_index(const QPoint &tile_pos) const
+	{
+		return static_cast<size_t>(tile_pos.x() - this->rect.x()) + static_cast<size_t>(tile_pos.y() - this->rect.y()) * this->rect.width();
+	}
+
+	QRect rect;
+	std::vector<bool> marks;
+};
+
 void CMap::AdjustMap()
 {
 	for (size_t z = 0; z < this->MapLayers.size(); ++z) {
 		Vec2i map_start_pos(0, 0);
 		Vec2i map_end(this->Info->MapWidths[z], this->Info->MapHeights[z]);
 		
+		stage_timer timer;
 		this->AdjustTileMapIrregularities(false, map_start_pos, map_end, z);
+		timer.print("Terrain irregularity adjustment for map layer " + std::to_string(z));
+
+		timer.restart();
 		this->AdjustTileMapIrregularities(true, map_start_pos, map_end, z);
+		timer.print("Overlay terrain irregularity adjustment for map layer " + std::to_string(z));
+
+		timer.restart();
 		this->AdjustTileMapTransitions(map_start_pos, map_end, z);
+		timer.print("Terrain transition adjustment for map layer " + std::to_string(z));
+
+		timer.restart();
 		this->AdjustTileMapIrregularities(true, map_start_pos, map_end, z);
+		timer.print("Overlay terrain irregularity readjustment for map layer " + std::to_string(z));
 	}
 }
 
@@ -2924,21 +3049,28 @@ void CMap::AdjustTileMapIrregularities(const bool overlay, const Vec2i &min_pos,
 	int try_count = 0;
 	static constexpr int max_try_count = 100;
 
+	tile_recheck_marks recheck_marks(QRect(QPoint(min_pos.x, min_pos.y), QPoint(max_pos.x - 1, max_pos.y - 1)));
+
 	while (!no_irregularities_found && try_count < max_try_count) {
 		no_irregularities_found = true;
 		++try_count;
 
 		for (int x = min_pos.x; x < max_pos.x; ++x) {
 			for (int y = min_pos.y; y < max_pos.y; ++y) {
+				if (!recheck_marks.take(QPoint(x, y))) {
+					continue;
+				}
+
 				tile &mf = *this->Field(x, y, z);
 				const terrain_type *terrain = overlay ? mf.get_overlay_terrain() : mf.get_terrain();
 				if (!terrain || terrain->allows_single()) {
 					continue;
 				}
 
-				std::set<const terrain_type *> acceptable_adjacent_tile_types;
-				acceptable_adjacent_tile_types.insert(terrain);
-				set::merge(acceptable_adjacent_tile_types, terrain->get_outer_border_terrain_types());
+				const std::vector<terrain_type *> &outer_border_terrain_types = terrain->get_outer_border_terrain_types();
+				const auto is_acceptable_adjacent_terrain = [terrain, &outer_border_terrain_types](const terrain_type *adjacent_terrain) {
+					return adjacent_terrain == terrain || vector::contains(outer_border_terrain_types, adjacent_terrain);
+				};
 				
 				int horizontal_adjacent_tiles = 0;
 				int vertical_adjacent_tiles = 0;
@@ -2947,42 +3079,42 @@ void CMap::AdjustTileMapIrregularities(const bool overlay, const Vec2i &min_pos,
 				int sw_quadrant_adjacent_tiles = 0;
 				int se_quadrant_adjacent_tiles = 0;
 				
-				if ((x - 1) >= 0 && !acceptable_adjacent_tile_types.contains(this->GetTileTerrain(Vec2i(x - 1, y), overlay, z))) {
+				if ((x - 1) >= 0 && !is_acceptable_adjacent_terrain(this->GetTileTerrain(Vec2i(x - 1, y), overlay, z))) {
 					horizontal_adjacent_tiles += 1;
 					nw_quadrant_adjacent_tiles += 1;
 					sw_quadrant_adjacent_tiles += 1;
 				}
-				if ((x + 1) < this->Info->MapWidths[z] && !acceptable_adjacent_tile_types.contains(this->GetTileTerrain(Vec2i(x + 1, y), overlay, z))) {
+				if ((x + 1) < this->Info->MapWidths[z] && !is_acceptable_adjacent_terrain(this->GetTileTerrain(Vec2i(x + 1, y), overlay, z))) {
 					horizontal_adjacent_tiles += 1;
 					ne_quadrant_adjacent_tiles += 1;
 					se_quadrant_adjacent_tiles += 1;
 				}
 				
-				if ((y - 1) >= 0 && !acceptable_adjacent_tile_types.contains(this->GetTileTerrain(Vec2i(x, y - 1), overlay, z))) {
+				if ((y - 1) >= 0 && !is_acceptable_adjacent_terrain(this->GetTileTerrain(Vec2i(x, y - 1), overlay, z))) {
 					vertical_adjacent_tiles += 1;
 					nw_quadrant_adjacent_tiles += 1;
 					ne_quadrant_adjacent_tiles += 1;
 				}
-				if ((y + 1) < this->Info->MapHeights[z] && !acceptable_adjacent_tile_types.contains(this->GetTileTerrain(Vec2i(x, y + 1), overlay, z))) {
+				if ((y + 1) < this->Info->MapHeights[z] && !is_acceptable_adjacent_terrain(this->GetTileTerrain(Vec2i(x, y + 1), overlay, z))) {
 					vertical_adjacent_tiles += 1;
 					sw_quadrant_adjacent_tiles += 1;
 					se_quadrant_adjacent_tiles += 1;
 				}
 
-				if ((x - 1) >= 0 && (y - 1) >= 0 && !acceptable_adjacent_tile_types.contains(this->GetTileTerrain(Vec2i(x - 1, y - 1), overlay, z))) {
+				if ((x - 1) >= 0 && (y - 1) >= 0 && !is_acceptable_adjacent_terrain(this->GetTileTerrain(Vec2i(x - 1, y - 1), overlay, z))) {
 					nw_quadrant_adjacent_tiles += 1;
 					se_quadrant_adjacent_tiles += 1;
 				}
 
-				if ((x - 1) >= 0 && (y + 1) < this->Info->MapHeights[z] && !acceptable_adjacent_tile_types.contains(GetTileTerrain(Vec2i(x - 1, y + 1), overlay, z))) {
+				if ((x - 1) >= 0 && (y + 1) < this->Info->MapHeights[z] && !is_acceptable_adjacent_terrain(GetTileTerrain(Vec2i(x - 1, y + 1), overlay, z))) {
 					sw_quadrant_adjacent_tiles += 1;
 					ne_quadrant_adjacent_tiles += 1;
 				}
-				if ((x + 1) < this->Info->MapWidths[z] && (y - 1) >= 0 && !acceptable_adjacent_tile_types.contains(GetTileTerrain(Vec2i(x + 1, y - 1), overlay, z))) {
+				if ((x + 1) < this->Info->MapWidths[z] && (y - 1) >= 0 && !is_acceptable_adjacent_terrain(GetTileTerrain(Vec2i(x + 1, y - 1), overlay, z))) {
 					ne_quadrant_adjacent_tiles += 1;
 					sw_quadrant_adjacent_tiles += 1;
 				}
-				if ((x + 1) < this->Info->MapWidths[z] && (y + 1) < this->Info->MapHeights[z] && !acceptable_adjacent_tile_types.contains(GetTileTerrain(Vec2i(x + 1, y + 1), overlay, z))) {
+				if ((x + 1) < this->Info->MapWidths[z] && (y + 1) < this->Info->MapHeights[z] && !is_acceptable_adjacent_terrain(GetTileTerrain(Vec2i(x + 1, y + 1), overlay, z))) {
 					se_quadrant_adjacent_tiles += 1;
 					nw_quadrant_adjacent_tiles += 1;
 				}
@@ -3017,6 +3149,7 @@ void CMap::AdjustTileMapIrregularities(const bool overlay, const Vec2i &min_pos,
 
 						mf.SetTerrain(best_terrain);
 					}
+					recheck_marks.mark_changed(QPoint(x, y));
 					no_irregularities_found = false;
 				}
 			}
@@ -3030,12 +3163,20 @@ void CMap::AdjustTileMapTransitions(const Vec2i &min_pos, const Vec2i &max_pos,
 	int try_count = 0;
 	static constexpr int max_try_count = 100;
 
+	const QRect rect(QPoint(min_pos.x, min_pos.y), QPoint(max_pos.x - 1, max_pos.y - 1));
+	tile_recheck_marks overlay_recheck_marks(rect);
+	tile_recheck_marks intermediate_recheck_marks(rect);
+
 	while (tile_changed && try_count < max_try_count) {
 		tile_changed = false;
 		++try_count;
 
 		for (int x = min_pos.x; x < max_pos.x; ++x) {
 			for (int y = min_pos.y; y < max_pos.y; ++y) {
+				if (!overlay_recheck_marks.take(QPoint(x, y))) {
+					continue;
+				}
+
 				wyrmgus::tile &mf = *this->Field(x, y, z);
 
 				if (mf.get_terrain() == nullptr) {
@@ -3063,6 +3204,8 @@ void CMap::AdjustTileMapTransitions(const Vec2i &min_pos, const Vec2i &max_pos,
 							&& !vector::contains(tile_top_terrain->get_base_terrain_types(), mf.get_terrain())
 						) {
 							mf.SetTerrain(tile_terrain);
+							overlay_recheck_marks.mark_changed(QPoint(x, y));
+							intermediate_recheck_marks.mark_changed(QPoint(x, y));
 							tile_changed = true;
 						}
 					}
@@ -3072,6 +3215,10 @@ void CMap::AdjustTileMapTransitions(const Vec2i &min_pos, const Vec2i &max_pos,
 
 		for (int x = min_pos.x; x < max_pos.x; ++x) {
 			for (int y = min_pos.y; y < max_pos.y; ++y) {
+				if (!intermediate_recheck_marks.take(QPoint(x, y))) {
+					continue;
+				}
+
 				wyrmgus::tile &mf = *this->Field(x, y, z);
 
 				if (mf.get_terrain() == nullptr) {
@@ -3094,6 +3241,8 @@ void CMap::AdjustTileMapTransitions(const Vec2i &min_pos, const Vec2i &max_pos,
 							const terrain_type *intermediate_terrain = mf.get_terrain()->get_intermediate_terrain_type(tile_terrain);
 							if (intermediate_terrain != nullptr) {
 								mf.SetTerrain(intermediate_terrain);
+								overlay_recheck_marks.mark_changed(QPoint(x, y));
+								intermediate_recheck_marks.mark_changed(QPoint(x, y));
 								tile_changed = true;
 							}
 						}
@@ -3210,23 +3359,15 @@ void CMap::generate_terrain(const generated_terrain *generated_terrain, const QP
 		}
 	}
 	
-	std::vector<QPoint> potential_positions;
-
-	if (seed_count > 0) {
-		for (int x = min_pos.x(); x <= max_pos.x(); ++x) {
-			for (int y = min_pos.y(); y <= max_pos.y(); ++y) {
-				potential_positions.push_back(QPoint(x, y));
-			}
-		}
-	}
+	random_position_sampler position_sampler(seed_count > 0 ? QRect(min_pos, max_pos) : QRect());
 	
 	// create initial seeds
-	while (count > 0 && !potential_positions.empty()) {
+	while (count > 0 && !position_sampler.is_empty()) {
 		if (max_tile_quantity != 0 && tile_quantity >= max_tile_quantity) {
 			break;
 		}
 		
-		random_pos = vector::take_random(potential_positions);
+		random_pos = position_sampler.take_random();
 		
 		if (!this->Info->IsPointOnMap(random_pos, z) || this->is_point_in_a_subtemplate_area(random_pos, z)) {
 			continue;
@@ -176,7 +176,7 @@ public:
 	void SetOverlayTerrainDamaged(const QPoint &pos, const bool damaged, const int z);
 	void calculate_tile_solid_tile(const QPoint &pos, const bool overlay, const int z);
 	void calculate_tile_transitions(const QPoint &pos, const bool overlay, const int z);
-	void CalculateTileLandmass(const Vec2i &pos, int z);
+	void calculate_landmasses(const int z);
 	void CalculateTileOwnershipTransition(const Vec2i &pos, int z);
 	void AdjustMap();
 	void AdjustTileMapIrregularities(const bool overlay, const Vec2i &min_pos, const Vec2i &max_pos, const int z);
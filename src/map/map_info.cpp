@@ -29,6 +29,7 @@
 
 #include "map/map_info.h"
 
+#include "database/gsml_data.h"
 #include "map/map_layer.h"
 #include "map/map_presets.h"
 #include "map/map_settings.h"
@@ -36,6 +37,7 @@
 #include "player/player_type.h"
 #include "util/log_util.h"
 #include "util/path_util.h"
+#include "util/string_conversion_util.h"
 #include "util/string_util.h"
 
 namespace wyrmgus {
@@ -56,6 +58,8 @@ void map_info::process_gsml_property(const gsml_property &property)
 
 	if (key == "settings") {
 		this->set_presets(map_presets::get(value));
+	} else if (key == "map_uid") {
+		this->MapUID = std::stoul(value);
 	} else {
 		database::get()->process_gsml_property_for_object(this, property);
 	}
@@ -84,6 +88,49 @@ void map_info::process_gsml_scope(const gsml_data &scope)
 	}
 }
 
+gsml_data map_info::to_gsml_data() const
+{
+	gsml_data data("map_info");
+
+	if (!this->get_name().empty()) {
+		data.add_property("name", "\"" + string::escaped(this->get_name()) + "\"");
+	}
+
+	if (!this->description.empty()) {
+		data.add_property("description", "\"" + string::escaped(this->description) + "\"");
+	}
+
+	if (!this->author.empty()) {
+		data.add_property("author", "\"" + string::escaped(this->author) + "\"");
+	}
+
+	data.add_child(gsml_data::from_size(this->get_map_size(), "map_size"));
+
+	gsml_data player_types_data("player_types");
+	for (const player_type player_type : this->get_player_types()) {
+		player_types_data.add_value(player_type_to_string(player_type));
+	}
+	data.add_child(std::move(player_types_data));
+
+	if (this->MapUID != 0) {
+		data.add_property("map_uid", std::to_string(this->MapUID));
+	}
+
+	data.add_property("map_world", "\"" + string::escaped(this->MapWorld) + "\"");
+
+	if (this->is_hidden()) {
+		data.add_property("hidden", string::from_bool(this->is_hidden()));
+	}
+
+	if (this->get_presets() != nullptr) {
+		data.add_property("settings", this->get_presets()->get_identifier());
+	} else if (this->get_settings() != nullptr) {
+		data.add_child(this->get_settings()->to_gsml_data());
+	}
+
+	return data;
+}
+
 /**
 **	@brief	Get whether a given coordinate is a valid point on the map
 **
@@ -188,10 +235,20 @@ qunique_ptr<map_info> map_info::duplicate() const
 	info->MapWorld = this->MapWorld;
 	info->settings = this->settings->duplicate();
 	info->presets = this->presets;
+	info->hidden = this->hidden;
 
 	return info;
 }
 
+void map_info::move_to_thread(QThread *thread)
+{
+	this->moveToThread(thread);
+
+	if (this->settings != nullptr) {
+		this->settings->moveToThread(thread);
+	}
+}
+
 QString map_info::get_presentation_filepath_qstring() const
 {
 	return path::to_qstring(this->get_presentation_filepath());
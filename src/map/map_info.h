@@ -73,6 +73,7 @@ public:
 
 	void process_gsml_property(const gsml_property &property);
 	void process_gsml_scope(const gsml_data &scope);
+	gsml_data to_gsml_data() const;
 
 	bool IsPointOnMap(const int x, const int y, const int z) const;
 
@@ -86,6 +87,9 @@ public:
 
 	qunique_ptr<map_info> duplicate() const;
 
+	//move the map info and its settings to another thread, e.g. after parsing it in a worker thread
+	void move_to_thread(QThread *thread);
+
 	const std::string &get_name() const
 	{
 		return this->name;
@@ -0,0 +1,187 @@
+//       _________ __                 __
+//      /   _____//  |_____________ _/  |______     ____  __ __  ______
+//      \_____  \\   __\_  __ \__  \\   __\__  \   / ___\|  |  \/  ___/
+//      /        \|  |  |  | \// __ \|  |  / __ \_/ /_/  >  |  /\___ |
+//     /_______  /|__|  |__|  (____  /__| (____  /\___  /|____//____  >
+//             \/                  \/          \//_____/            \/
+//  ______________________                           ______________________
+//                        T H E   W A R   B E G I N S
+//         Stratagus - A free fantasy real time strategy game engine
+//
+//      (c) Copyright 2026 by Andrettin
+//
+//      This program is free software; you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation; only version 2 of the License.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program; if not, write to the Free Software
+//      Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+//      02111-1307, USA.
+
+#include "stratagus.h"
+
+#include "map/map_info_catalog.h"
+
+#include "database/database.h"
+#include "database/gsml_binary.h"
+#include "database/gsml_data.h"
+#include "map/map_info.h"
+#include "util/exception_util.h"
+#include "util/log_util.h"
+#include "util/path_util.h"
+#include "util/string_util.h"
+
+namespace wyrmgus {
+
+//use the generic form of the path as the key, so that it is stored the same way on all platforms
+static std::string get_map_info_catalog_key(const std::filesystem::path &filepath)
+{
+	std::string key = path::to_string(filepath);
+	std::replace(key.begin(), key.end(), '\\', '/');
+	return key;
+}
+
+std::filesystem::path map_info_catalog::get_path()
+{
+	return database::get_user_data_path() / "map_catalog.dat";
+}
+
+int64_t map_info_catalog::get_modification_time(const std::filesystem::path &filepath)
+{
+	return static_cast<int64_t>(std::filesystem::last_write_time(filepath).time_since_epoch().count());
+}
+
+map_info_catalog::map_info_catalog()
+{
+}
+
+map_info_catalog::~map_info_catalog()
+{
+}
+
+void map_info_catalog::load()
+{
+	if (this->loaded) {
+		return;
+	}
+
+	this->loaded = true;
+
+	const std::filesystem::path catalog_path = map_info_catalog::get_path();
+
+	if (!std::filesystem::exists(catalog_path)) {
+		return;
+	}
+
+	gsml_data data;
+
+	try {
+		data = read_gsml_binary_file(catalog_path);
+	} catch (...) {
+		exception::report(std::current_exception());
+		log::log_error("Failed to read the map catalog file.");
+		return;
+	}
+
+	data.for_each_child([&](const gsml_data &entry_data) {
+		//use a try-catch for each entry, as the map presets or unit types it refers to could no longer exist; the map will then simply be parsed again
+		try {
+			const std::string key = entry_data.get_property_value("path");
+			const int64_t modification_time = std::stoll(entry_data.get_property_value("modified"));
+
+			auto info = make_qunique<map_info>();
+			entry_data.get_child("map_info").process(info.get());
+			info->set_presentation_filepath(path::from_string(key));
+
+			entry &catalog_entry = this->entries[key];
+			catalog_entry.modification_time = modification_time;
+			catalog_entry.info = std::move(info);
+		} catch (...) {
+			exception::report(std::current_exception());
+			this->changed = true;
+		}
+	});
+}
+
+void map_info_catalog::save()
+{
+	if (!this->changed) {
+		return;
+	}
+
+	gsml_data data;
+
+	for (const auto &[key, catalog_entry] : this->entries) {
+		gsml_data entry_data("map");
+		entry_data.add_property("path", "\"" + string::escaped(key) + "\"");
+		entry_data.add_property("modified", std::to_string(catalog_entry.modification_time));
+		entry_data.add_child(catalog_entry.info->to_gsml_data());
+		data.add_child(std::move(entry_data));
+	}
+
+	try {
+		write_gsml_binary_file(data, map_info_catalog::get_path());
+	} catch (...) {
+		exception::report(std::current_exception());
+		log::log_error("Failed to save the map catalog file.");
+		return;
+	}
+
+	this->changed = false;
+}
+
+bool map_info_catalog::is_up_to_date(const std::filesystem::path &filepath, const int64_t modification_time) const
+{
+	const auto find_iterator = this->entries.find(get_map_info_catalog_key(filepath));
+
+	if (find_iterator == this->entries.end()) {
+		return false;
+	}
+
+	return find_iterator->second.modification_time == modification_time;
+}
+
+map_info *map_info_catalog::get_map_info(const std::filesystem::path &filepath) const
+{
+	const auto find_iterator = this->entries.find(get_map_info_catalog_key(filepath));
+
+	if (find_iterator == this->entries.end()) {
+		return nullptr;
+	}
+
+	return find_iterator->second.info.get();
+}
+
+void map_info_catalog::set_map_info(const std::filesystem::path &filepath, const int64_t modification_time, qunique_ptr<map_info> &&info)
+{
+	entry &catalog_entry = this->entries[get_map_info_catalog_key(filepath)];
+	catalog_entry.modification_time = modification_time;
+	catalog_entry.info = std::move(info);
+
+	this->changed = true;
+}
+
+void map_info_catalog::retain(const std::vector<std::filesystem::path> &filepaths)
+{
+	std::set<std::string> keys;
+
+	for (const std::filesystem::path &filepath : filepaths) {
+		keys.insert(get_map_info_catalog_key(filepath));
+	}
+
+	const size_t erased_count = std::erase_if(this->entries, [&keys](const auto &key_value_pair) {
+		return !keys.contains(key_value_pair.first);
+	});
+
+	if (erased_count > 0) {
+		this->changed = true;
+	}
+}
+
+}
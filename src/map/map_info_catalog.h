@@ -0,0 +1,70 @@
+//       _________ __                 __
+//      /   _____//  |_____________ _/  |______     ____  __ __  ______
+//      \_____  \\   __\_  __ \__  \\   __\__  \   / ___\|  |  \/  ___/
+//      /        \|  |  |  | \// __ \|  |  / __ \_/ /_/  >  |  /\___ |
+//     /_______  /|__|  |__|  (____  /__| (____  /\___  /|____//____  >
+//             \/                  \/          \//_____/            \/
+//  ______________________                           ______________________
+//                        T H E   W A R   B E G I N S
+//         Stratagus - A free fantasy real time strategy game engine
+//
+//      (c) Copyright 2026 by Andrettin
+//
+//      This program is free software; you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation; only version 2 of the License.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program; if not, write to the Free Software
+//      Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+//      02111-1307, USA.
+
+#pragma once
+
+#include "util/qunique_ptr.h"
+#include "util/singleton.h"
+
+namespace wyrmgus {
+
+class map_info;
+
+//a persistent catalog of map presentation data, keyed by the path of each presentation file and its modification time, so that the map list can be shown without parsing every map file
+//the catalog is stored as binary gsml data, so that it is itself read without being tokenized
+class map_info_catalog final : public singleton<map_info_catalog>
+{
+private:
+	struct entry final
+	{
+		int64_t modification_time = 0;
+		qunique_ptr<map_info> info;
+	};
+
+public:
+	static std::filesystem::path get_path();
+	static int64_t get_modification_time(const std::filesystem::path &filepath);
+
+	map_info_catalog();
+	~map_info_catalog();
+
+	void load();
+	void save();
+
+	bool is_up_to_date(const std::filesystem::path &filepath, const int64_t modification_time) const;
+	map_info *get_map_info(const std::filesystem::path &filepath) const;
+	void set_map_info(const std::filesystem::path &filepath, const int64_t modification_time, qunique_ptr<map_info> &&info);
+
+	//remove the entries for map files which are no longer present
+	void retain(const std::vector<std::filesystem::path> &filepaths);
+
+private:
+	std::map<std::string, entry> entries; //entries mapped to the generic form of their file path
+	bool loaded = false;
+	bool changed = false;
+};
+
+}
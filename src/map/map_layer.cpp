@@ -29,9 +29,11 @@
 #include "map/map_layer.h"
 
 #include "database/defines.h"
+#include "economy/resource_source_index.h"
 #include "engine_interface.h"
 #include "map/map.h"
 #include "map/map_info.h"
+#include "map/map_template.h"
 #include "map/minimap.h"
 #include "map/terrain_type.h"
 #include "map/tile.h"
@@ -66,6 +68,8 @@ CMapLayer::CMapLayer(const QSize &size) : size(size)
 	} catch (const std::bad_alloc &) {
 		std::throw_with_nested(std::runtime_error("Failed to allocate map layer with a tile area of " + std::to_string(max_tile_index) + ", for " + std::to_string(max_tile_index * sizeof(wyrmgus::tile)) + " bytes in total."));
 	}
+
+	this->resource_source_index = std::make_unique<wyrmgus::resource_source_index>(this);
 }
 
 CMapLayer::~CMapLayer()
@@ -523,3 +527,58 @@ const wyrmgus::season *CMapLayer::get_tile_season(const QPoint &tile_pos) const
 {
 	return this->get_tile_season(point::to_index(tile_pos, this->get_width()));
 }
+
+void CMapLayer::set_subtemplate_area(const map_template *map_template, const QRect &map_rect)
+{
+	QRect old_rect;
+
+	const auto find_iterator = this->subtemplate_areas.find(map_template);
+	if (find_iterator != this->subtemplate_areas.end()) {
+		old_rect = find_iterator->second;
+	}
+
+	this->subtemplate_areas[map_template] = map_rect;
+
+	if (this->tile_subtemplates.empty()) {
+		this->tile_subtemplates.resize(this->get_width() * this->get_height(), nullptr);
+	}
+
+	if (old_rect.isValid() && old_rect != map_rect) {
+		//the subtemplate has been applied elsewhere, so its previous area needs to be assigned to any other subtemplates covering it
+		this->update_tile_subtemplates(old_rect);
+	}
+
+	const QRect layer_rect(QPoint(0, 0), this->get_size());
+	const QRect clipped_rect = map_rect.intersected(layer_rect);
+
+	for (int x = clipped_rect.left(); x <= clipped_rect.right(); ++x) {
+		for (int y = clipped_rect.top(); y <= clipped_rect.bottom(); ++y) {
+			const QPoint tile_pos(x, y);
+
+			if (map_template->is_map_pos_usable(tile_pos)) {
+				this->tile_subtemplates[point::to_index(tile_pos, this->get_width())] = map_template;
+			}
+		}
+	}
+}
+
+void CMapLayer::update_tile_subtemplates(const QRect &rect)
+{
+	const QRect layer_rect(QPoint(0, 0), this->get_size());
+	const QRect clipped_rect = rect.intersected(layer_rect);
+
+	for (int x = clipped_rect.left(); x <= clipped_rect.right(); ++x) {
+		for (int y = clipped_rect.top(); y <= clipped_rect.bottom(); ++y) {
+			const QPoint tile_pos(x, y);
+			const map_template *tile_subtemplate = nullptr;
+
+			for (const auto &[subtemplate, subtemplate_rect] : this->subtemplate_areas) {
+				if (subtemplate_rect.contains(tile_pos) && subtemplate->is_map_pos_usable(tile_pos)) {
+					tile_subtemplate = subtemplate;
+				}
+			}
+
+			this->tile_subtemplates[point::to_index(tile_pos, this->get_width())] = tile_subtemplate;
+		}
+	}
+}
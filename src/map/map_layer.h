@@ -27,6 +27,7 @@
 #pragma once
 
 #include "map/map_template_container.h"
+#include "util/point_util.h"
 #include "vec2i.h"
 
 Q_MOC_INCLUDE("map/tile_transition.h")
@@ -43,6 +44,7 @@ namespace archimedes {
 
 namespace wyrmgus {
 	class player_color;
+	class resource_source_index;
 	class scheduled_season;
 	class scheduled_time_of_day;
 	class season;
@@ -111,6 +113,11 @@ public:
 		return this->get_size().height();
 	}
 	
+	wyrmgus::resource_source_index *get_resource_source_index() const
+	{
+		return this->resource_source_index.get();
+	}
+
 	void DoPerHourLoop();
 	void handle_destroyed_overlay_terrain();
 	void decay_destroyed_overlay_terrain_tile(const QPoint &pos);
@@ -194,6 +201,25 @@ public:
 		return empty_rect;
 	}
 
+	void set_subtemplate_area(const wyrmgus::map_template *map_template, const QRect &map_rect);
+
+	//get the subtemplate whose usable area contains the tile position, if any; if several do, the one applied last
+	const wyrmgus::map_template *get_tile_subtemplate(const QPoint &tile_pos) const
+	{
+		if (this->tile_subtemplates.empty()) {
+			return nullptr;
+		}
+
+		if (tile_pos.x() < 0 || tile_pos.y() < 0 || tile_pos.x() >= this->get_width() || tile_pos.y() >= this->get_height()) {
+			return nullptr;
+		}
+
+		return this->tile_subtemplates[point::to_index(tile_pos, this->get_width())];
+	}
+
+private:
+	void update_tile_subtemplates(const QRect &rect);
+
 signals:
 	void tile_image_changed(QPoint tile_pos, const terrain_type *terrain, short tile_frame, const player_color *player_color) const;
 	void tile_overlay_image_changed(QPoint tile_pos, const terrain_type *terrain, short tile_frame, const player_color *player_color) const;
@@ -213,6 +239,7 @@ public:
 private:
 	std::unique_ptr<wyrmgus::tile[]> Fields; //fields on the map layer
 	QSize size;									/// the size in tiles of the map layer
+	std::unique_ptr<wyrmgus::resource_source_index> resource_source_index; //the resource sources of the map layer, indexed by position
 	const scheduled_time_of_day *time_of_day = nullptr;	/// the time of day for the map layer
 	const wyrmgus::time_of_day_schedule *time_of_day_schedule = nullptr; //the time of day schedule for the map layer
 public:
@@ -225,6 +252,9 @@ public:
 	const wyrmgus::world *world = nullptr;			/// the world pointer (if any) for the map layer
 	std::vector<CUnit *> LayerConnectors;		/// connectors in the map layer which lead to other map layers
 	wyrmgus::map_template_map<QRect> subtemplate_areas;
+private:
+	std::vector<const wyrmgus::map_template *> tile_subtemplates; //the subtemplate owning each tile, indexed by tile index; empty if there are no subtemplate areas
+public:
 	std::vector<QPoint> destroyed_overlay_terrain_tiles; /// destroyed overlay terrain tiles (excluding trees)
 	std::vector<QPoint> destroyed_tree_tiles;	/// destroyed tree tiles; this list is used for forest regeneration
 
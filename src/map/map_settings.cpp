@@ -29,9 +29,11 @@
 #include "map/map_settings.h"
 
 #include "database/database.h"
+#include "database/gsml_data.h"
 #include "unit/unit_type.h"
 #include "upgrade/upgrade_modifier.h"
 #include "upgrade/upgrade_structs.h"
+#include "util/string_util.h"
 
 namespace wyrmgus {
 
@@ -58,6 +60,33 @@ void map_settings::process_gsml_scope(const gsml_data &scope)
 	}
 }
 
+gsml_data map_settings::to_gsml_data() const
+{
+	gsml_data data("settings");
+
+	if (!this->name.empty()) {
+		data.add_property("name", "\"" + string::escaped(this->name) + "\"");
+	}
+
+	if (!this->disabled_unit_types.empty()) {
+		gsml_data disabled_unit_types_data("disabled_unit_types");
+		for (const unit_type *unit_type : this->disabled_unit_types) {
+			disabled_unit_types_data.add_value(unit_type->get_identifier());
+		}
+		data.add_child(std::move(disabled_unit_types_data));
+	}
+
+	if (!this->starting_upgrades.empty()) {
+		gsml_data starting_upgrades_data("starting_upgrades");
+		for (const CUpgrade *upgrade : this->starting_upgrades) {
+			starting_upgrades_data.add_value(upgrade->get_identifier());
+		}
+		data.add_child(std::move(starting_upgrades_data));
+	}
+
+	return data;
+}
+
 qunique_ptr<map_settings> map_settings::duplicate() const
 {
 	auto settings = make_qunique<map_settings>();
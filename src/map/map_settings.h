@@ -46,6 +46,7 @@ class map_settings final : public QObject
 public:
 	void process_gsml_property(const gsml_property &property);
 	void process_gsml_scope(const gsml_data &scope);
+	gsml_data to_gsml_data() const;
 
 	qunique_ptr<map_settings> duplicate() const;
 
@@ -51,6 +51,7 @@
 #include "map/map_template_history.h"
 #include "map/map_template_unit.h"
 #include "map/pmp.h"
+#include "map/random_position_sampler.h"
 #include "map/region.h"
 #include "map/site.h"
 #include "map/site_game_data.h"
@@ -1251,7 +1252,7 @@ void map_template::apply(const QPoint &template_start_pos, const QPoint &map_sta
 	const QRect map_rect(map_start_pos, map_end - Vec2i(1, 1));
 
 	if (this->IsSubtemplateArea()) {
-		CMap::get()->MapLayers[z]->subtemplate_areas[this] = map_rect;
+		CMap::get()->MapLayers[z]->set_subtemplate_area(this, map_rect);
 
 		//if this is the top subtemplate for a given world, set the world's map rect to this map template's map rect
 		if (this->get_world() != nullptr && this->get_world() != this->get_main_template()->get_world()) {
@@ -2179,21 +2180,14 @@ std::vector<QPoint> map_template::generate_zone_seeds(const int z, const size_t
 {
 	static constexpr int min_zone_seed_distance = 16;
 
-	std::vector<QPoint> potential_positions;
-	potential_positions.reserve(CMap::get()->MapLayers[z]->get_width() * CMap::get()->MapLayers[z]->get_height());
-
-	for (int x = 0; x < CMap::get()->MapLayers[z]->get_width(); ++x) {
-		for (int y = 0; y < CMap::get()->MapLayers[z]->get_height(); ++y) {
-			potential_positions.emplace_back(x, y);
-		}
-	}
+	random_position_sampler position_sampler(QRect(QPoint(0, 0), CMap::get()->MapLayers[z]->get_size()));
 
 	std::vector<QPoint> zone_seeds;
 	zone_seeds.reserve(seed_count);
 
 	for (size_t i = 0; i < seed_count; ++i) {
-		while (!potential_positions.empty()) {
-			QPoint random_pos = vector::take_random(potential_positions);
+		while (!position_sampler.is_empty()) {
+			QPoint random_pos = position_sampler.take_random();
 
 			bool valid_location = true;
 			for (const QPoint &seed : zone_seeds) {
@@ -4240,12 +4234,7 @@ QPoint map_template::generate_subtemplate_position(map_template *subtemplate, co
 		min_pos.setX(std::max<short>(min_pos.x(), other_template_pos.x() + other_template->get_applied_width() - (subtemplate_applied_size.width() / 2)));
 	}
 
-	std::vector<QPoint> potential_positions;
-	for (int x = min_pos.x(); x <= max_pos.x(); ++x) {
-		for (int y = min_pos.y(); y <= max_pos.y(); ++y) {
-			potential_positions.push_back(QPoint(x, y));
-		}
-	}
+	random_position_sampler position_sampler(QRect(min_pos, max_pos));
 
 	//include the offsets relevant for the templates dependent on this one's position (e.g. templates that have to be to the north of this one), so that there is enough space for them to be generated there
 	const int north_offset = optional ? 0 : subtemplate->GetDependentTemplatesNorthOffset();
@@ -4255,7 +4244,7 @@ QPoint map_template::generate_subtemplate_position(map_template *subtemplate, co
 
 	int try_count = 0;
 
-	while (!potential_positions.empty()) {
+	while (!position_sampler.is_empty()) {
 		// for the sake of performance, put a limit on optional subtemplate placement tries, instead of checking all possibilities
 		if (optional && try_count >= 1000) {
 			break;
@@ -4263,7 +4252,7 @@ QPoint map_template::generate_subtemplate_position(map_template *subtemplate, co
 
 		++try_count;
 
-		const QPoint subtemplate_pos = vector::take_random(potential_positions);
+		const QPoint subtemplate_pos = position_sampler.take_random();
 
 		const bool top_left_on_map = this->contains_map_pos(subtemplate_pos - QPoint(west_offset, north_offset));
 		const bool bottom_right_on_map = this->contains_map_pos(QPoint(subtemplate_pos.x() + subtemplate_applied_size.width() + east_offset - 1, subtemplate_pos.y() + subtemplate_applied_size.height() + south_offset - 1));
@@ -34,6 +34,7 @@
 #include "map/map_info.h"
 #include "map/map_layer.h"
 #include "map/minimap_mode.h"
+#include "map/minimap_texture.h"
 #include "map/site.h"
 #include "map/site_game_data.h"
 #include "map/terrain_type.h"
@@ -45,7 +46,6 @@
 #include "unit/unit.h"
 #include "unit/unit_manager.h"
 #include "unit/unit_type.h"
-#include "util/log_util.h"
 #include "util/vector_util.h"
 #include "video/renderer.h"
 #include "video/video.h"
@@ -76,7 +76,14 @@ int NumMinimapEvents;
 
 namespace wyrmgus {
 
-minimap::minimap() : mode(minimap_mode::terrain)
+/// maximum number of changed overlay rectangles for which the overlay is updated incrementally, rather than redrawn entirely
+static constexpr size_t MAX_OVERLAY_DIRTY_RECTS = 256;
+
+minimap::minimap() : mode(minimap_mode::terrain), unit_marks_mode(minimap_mode::terrain)
+{
+}
+
+minimap::~minimap()
 {
 }
 
@@ -137,15 +144,15 @@ void minimap::Create()
 
 		QImage terrain_image(this->minimap_texture_width[z], this->minimap_texture_height[z], QImage::Format_RGBA8888);
 		terrain_image.fill(Qt::transparent);
-		this->terrain_images.push_back(std::move(terrain_image));
+		this->terrain_textures.push_back(std::make_unique<minimap_texture>(std::move(terrain_image)));
 
 		QImage unexplored_image(this->minimap_texture_width[z], this->minimap_texture_height[z], QImage::Format_RGBA8888);
 		unexplored_image.fill(Qt::transparent);
-		this->unexplored_images.push_back(std::move(unexplored_image));
+		this->unexplored_textures.push_back(std::make_unique<minimap_texture>(std::move(unexplored_image)));
 
 		QImage fog_of_war_image(this->minimap_texture_width[z], this->minimap_texture_height[z], QImage::Format_RGBA8888);
 		fog_of_war_image.fill(Qt::transparent);
-		this->fog_of_war_images.push_back(std::move(fog_of_war_image));
+		this->fog_of_war_textures.push_back(std::make_unique<minimap_texture>(std::move(fog_of_war_image)));
 
 		for (int i = 0; i < static_cast<int>(minimap_mode::count); ++i) {
 			const minimap_mode mode = static_cast<minimap_mode>(i);
@@ -158,13 +165,18 @@ void minimap::Create()
 
 		QImage overlay_image(this->minimap_texture_width[z], this->minimap_texture_height[z], QImage::Format_RGBA8888);
 		overlay_image.fill(Qt::transparent);
-		this->overlay_images.push_back(std::move(overlay_image));
+		this->overlay_textures.push_back(std::make_unique<minimap_texture>(std::move(overlay_image)));
+
+		this->overlay_base_dirty_rects.emplace_back();
 
 		this->UpdateTerrain(z);
 		this->update_territories(z);
 		this->update_exploration(z);
 	}
 
+	this->unit_marks.clear();
+	this->unit_marks_z = -1;
+
 	NumMinimapEvents = 0;
 }
 
@@ -176,7 +188,7 @@ void minimap::UpdateTerrain(int z)
 	const CMapLayer *map_layer = CMap::get()->MapLayers[z].get();
 	const int texture_width = this->get_texture_width(z);
 	const int texture_height = this->get_texture_height(z);
-	unsigned char *terrain_image_buffer = this->terrain_images[z].bits();
+	unsigned char *terrain_image_buffer = this->terrain_textures[z]->get_image().bits();
 	
 	for (int my = YOffset[z]; my < texture_height - YOffset[z]; ++my) {
 		for (int mx = XOffset[z]; mx < texture_width - XOffset[z]; ++mx) {
@@ -192,6 +204,8 @@ void minimap::UpdateTerrain(int z)
 			*(uint32_t *) &(terrain_image_buffer[(mx + my * this->minimap_texture_width[z]) * 4]) = c;
 		}
 	}
+
+	this->terrain_textures[z]->mark_all_dirty();
 }
 
 void minimap::update_territories(const int z)
@@ -204,6 +218,8 @@ void minimap::update_territories(const int z)
 			this->update_territory_pixel(mx, my, z);
 		}
 	}
+
+	this->mark_overlay_base_dirty(QRect(0, 0, texture_width, texture_height), z);
 }
 
 void minimap::update_exploration(const int z)
@@ -227,6 +243,9 @@ void minimap::update_exploration(const int z)
 			this->update_exploration_pixel(mx, my, z, visibility_state);
 		}
 	}
+
+	this->unexplored_textures[z]->mark_all_dirty();
+	this->fog_of_war_textures[z]->mark_all_dirty();
 }
 
 /**
@@ -237,7 +256,7 @@ void minimap::update_exploration(const int z)
 */
 void minimap::UpdateXY(const Vec2i &pos, const int z)
 {
-	if (z >= static_cast<int>(this->terrain_images.size())) {
+	if (z >= static_cast<int>(this->terrain_textures.size())) {
 		return;
 	}
 
@@ -257,7 +276,8 @@ void minimap::UpdateXY(const Vec2i &pos, const int z)
 
 	const int texture_width = this->get_texture_width(z);
 	const int texture_height = this->get_texture_height(z);
-	unsigned char *terrain_image_buffer = this->terrain_images[z].bits();
+	unsigned char *terrain_image_buffer = this->terrain_textures[z]->get_image().bits();
+	QRect changed_rect;
 
 	for (int my = YOffset[z]; my < texture_height - YOffset[z]; ++my) {
 		const int y = this->minimap_to_map_y[z][my];
@@ -285,8 +305,11 @@ void minimap::UpdateXY(const Vec2i &pos, const int z)
 
 			const uint32_t c = CVideo::MapRGB(color);
 			*(uint32_t *) &(terrain_image_buffer[(mx + my * this->minimap_texture_width[z]) * 4]) = c;
+			changed_rect |= QRect(mx, my, 1, 1);
 		}
 	}
+
+	this->terrain_textures[z]->mark_dirty(changed_rect);
 }
 
 void minimap::update_territory_xy(const QPoint &pos, const int z)
@@ -296,6 +319,7 @@ void minimap::update_territory_xy(const QPoint &pos, const int z)
 
 	const int ty = pos.y() * CMap::get()->Info->MapWidths[z];
 	const int tx = pos.x();
+	QRect changed_rect;
 
 	for (int my = YOffset[z]; my < texture_height - YOffset[z]; ++my) {
 		const int y = this->minimap_to_map_y[z][my];
@@ -317,8 +341,11 @@ void minimap::update_territory_xy(const QPoint &pos, const int z)
 			}
 
 			this->update_territory_pixel(mx, my, z);
+			changed_rect |= QRect(mx, my, 1, 1);
 		}
 	}
+
+	this->mark_overlay_base_dirty(changed_rect, z);
 }
 
 void minimap::update_territory_pixel(const int mx, const int my, const int z)
@@ -422,6 +449,8 @@ void minimap::update_exploration_xy(const QPoint &pos, const int z)
 		visibility_state = tile->player_info->get_team_visibility_state(*CPlayer::GetThisPlayer());
 	}
 
+	QRect changed_rect;
+
 	for (int my = YOffset[z]; my < texture_height - YOffset[z]; ++my) {
 		const int y = this->minimap_to_map_y[z][my];
 		if (y < ty) {
@@ -442,8 +471,12 @@ void minimap::update_exploration_xy(const QPoint &pos, const int z)
 			}
 
 			this->update_exploration_pixel(mx, my, z, visibility_state);
+			changed_rect |= QRect(mx, my, 1, 1);
 		}
 	}
+
+	this->unexplored_textures[z]->mark_dirty(changed_rect);
+	this->fog_of_war_textures[z]->mark_dirty(changed_rect);
 }
 
 void minimap::update_exploration_pixel(const int mx, const int my, const int z, const unsigned short visibility_state)
@@ -452,15 +485,15 @@ void minimap::update_exploration_pixel(const int mx, const int my, const int z,
 
 	switch (visibility_state) {
 		case 0:
-			this->unexplored_images[z].setPixelColor(mx, my, minimap::unexplored_color);
+			this->unexplored_textures[z]->get_image().setPixelColor(mx, my, minimap::unexplored_color);
 			break;
 		case 1:
-			this->unexplored_images[z].setPixelColor(mx, my, transparent_color);
-			this->fog_of_war_images[z].setPixelColor(mx, my, minimap::fog_of_war_color);
+			this->unexplored_textures[z]->get_image().setPixelColor(mx, my, transparent_color);
+			this->fog_of_war_textures[z]->get_image().setPixelColor(mx, my, minimap::fog_of_war_color);
 			break;
 		default:
-			this->unexplored_images[z].setPixelColor(mx, my, transparent_color);
-			this->fog_of_war_images[z].setPixelColor(mx, my, transparent_color);
+			this->unexplored_textures[z]->get_image().setPixelColor(mx, my, transparent_color);
+			this->fog_of_war_textures[z]->get_image().setPixelColor(mx, my, transparent_color);
 			break;
 	}
 }
@@ -535,7 +568,7 @@ QColor minimap::get_terrain_unit_minimap_color(const CUnit *unit, const unit_typ
 	return QColor(Qt::transparent);
 }
 
-void minimap::draw_unit(const CUnit *unit, const bool red_phase)
+std::optional<minimap_unit_mark> minimap::get_unit_mark(const CUnit *unit, const bool red_phase) const
 {
 	const int z = UI.CurrentMapLayer->ID;
 
@@ -543,7 +576,7 @@ void minimap::draw_unit(const CUnit *unit, const bool red_phase)
 
 	//don't draw decorations or diminutive fauna units on the minimap
 	if (type->BoolFlag[DECORATION_INDEX].value || (type->BoolFlag[DIMINUTIVE_INDEX].value && type->BoolFlag[FAUNA_INDEX].value)) {
-		return;
+		return std::nullopt;
 	}
 
 	const uint32_t color = this->get_unit_minimap_color(unit, type, red_phase);
@@ -559,39 +592,193 @@ void minimap::draw_unit(const CUnit *unit, const bool red_phase)
 		w = texture_width - mx;
 	}
 
-	int h0 = this->map_to_minimap_y[z][type->get_tile_height()];
-	if (my + h0 >= texture_height) { //clip bottom side
-		h0 = texture_height - my;
+	int h = this->map_to_minimap_y[z][type->get_tile_height()];
+	if (my + h >= texture_height) { //clip bottom side
+		h = texture_height - my;
 	}
 
-	unsigned char *overlay_image_buffer = this->overlay_images[z].bits();
-
-	while (w-- >= 0) {
-		int h = h0;
-		while (h-- >= 0) {
-			*(uint32_t *) &(overlay_image_buffer[((mx + w) + (my + h) * this->minimap_texture_width[z]) * 4]) = color;
-		}
-	}
+	minimap_unit_mark mark;
+	//the unit covers the pixels from one before its minimap position up to the end of its size
+	mark.rect = QRect(mx - 1, my - 1, w + 1, h + 1);
+	mark.color = CVideo::GetRGBA(color);
+	return mark;
 }
 
-//draw a unit as terrain, on its center tile
-void minimap::draw_terrain_unit(const CUnit *unit, const bool red_phase)
+//get the mark for a unit drawn as terrain, on its center tile
+std::optional<minimap_unit_mark> minimap::get_terrain_unit_mark(const CUnit *unit, const bool red_phase) const
 {
 	const unit_type *type = this->get_unit_minimap_type(unit);
-	const QColor color = this->get_terrain_unit_minimap_color(unit, type, red_phase);
 
 	const int z = UI.CurrentMapLayer->ID;
 
 	const int x = this->XOffset[z] + this->map_to_minimap_x[z][unit->tilePos.x];
 	const int y = this->YOffset[z] + this->map_to_minimap_y[z][unit->tilePos.y];
 
-	//draw as a circle
-	QPainter painter(&this->overlay_images[z]);
-	painter.setRenderHint(QPainter::Antialiasing);
-	painter.setBrush(QBrush(color));
-	painter.setPen(QPen(color));
+	minimap_unit_mark mark;
+	mark.rect = QRect(x, y, type->get_tile_width() + 1, type->get_tile_height() + 1);
+	mark.color = this->get_terrain_unit_minimap_color(unit, type, red_phase);
+	mark.ellipse = true;
+	return mark;
+}
+
+std::vector<std::pair<const CUnit *, minimap_unit_mark>> minimap::get_unit_marks(const bool red_phase) const
+{
+	std::vector<std::pair<const CUnit *, minimap_unit_mark>> unit_marks;
+
+	if (this->are_units_visible()) {
+		//draw units on the map
+		for (const CUnit *unit : unit_manager::get()->get_units()) {
+			if (!unit->IsVisibleOnMinimap()) {
+				continue;
+			}
+
+			std::optional<minimap_unit_mark> mark = this->get_unit_mark(unit, red_phase);
+			if (mark.has_value()) {
+				unit_marks.emplace_back(unit, std::move(mark.value()));
+			}
+		}
+	} else {
+		//when drawing only terrain, draw celestial body units on their center tile
+		for (const CUnit *unit : unit_manager::get()->get_units()) {
+			if (!unit->Type->BoolFlag[CELESTIAL_BODY_INDEX].value && !unit->Type->BoolFlag[ASTEROID_INDEX].value) {
+				continue;
+			}
+
+			if (!unit->IsVisibleOnMinimap()) {
+				continue;
+			}
+
+			std::optional<minimap_unit_mark> mark = this->get_terrain_unit_mark(unit, red_phase);
+			if (mark.has_value()) {
+				unit_marks.emplace_back(unit, std::move(mark.value()));
+			}
+		}
+	}
+
+	return unit_marks;
+}
+
+//get the rectangles of the overlay affected by units which appeared, disappeared, moved or changed color since the last update
+std::vector<QRect> minimap::get_changed_unit_mark_rects(const std::vector<std::pair<const CUnit *, minimap_unit_mark>> &unit_marks) const
+{
+	std::vector<QRect> changed_rects;
+
+	std::unordered_map<const CUnit *, const minimap_unit_mark *> old_unit_marks;
+	old_unit_marks.reserve(this->unit_marks.size());
+
+	for (const auto &[unit, mark] : this->unit_marks) {
+		old_unit_marks[unit] = &mark;
+	}
+
+	for (const auto &[unit, mark] : unit_marks) {
+		const auto find_iterator = old_unit_marks.find(unit);
+
+		if (find_iterator == old_unit_marks.end()) {
+			changed_rects.push_back(mark.get_covered_rect());
+			continue;
+		}
+
+		if (*find_iterator->second != mark) {
+			changed_rects.push_back(find_iterator->second->get_covered_rect());
+			changed_rects.push_back(mark.get_covered_rect());
+		}
+
+		old_unit_marks.erase(find_iterator);
+	}
+
+	for (const auto &[unit, mark] : old_unit_marks) {
+		changed_rects.push_back(mark->get_covered_rect());
+	}
+
+	return changed_rects;
+}
+
+void minimap::draw_unit_mark(const minimap_unit_mark &mark, const QRect &clip_rect, const int z)
+{
+	QImage &overlay_image = this->overlay_textures[z]->get_image();
+
+	if (mark.ellipse) {
+		//draw as a circle
+		QPainter painter(&overlay_image);
+		painter.setClipRect(clip_rect);
+		painter.setRenderHint(QPainter::Antialiasing);
+		painter.setBrush(QBrush(mark.color));
+		painter.setPen(QPen(mark.color));
+
+		painter.drawEllipse(mark.rect);
+		return;
+	}
+
+	const QRect rect = mark.rect.intersected(clip_rect);
+	if (rect.isEmpty()) {
+		return;
+	}
+
+	const uint32_t color = CVideo::MapRGBA(mark.color);
+	unsigned char *overlay_image_buffer = overlay_image.bits();
+
+	for (int y = rect.top(); y <= rect.bottom(); ++y) {
+		for (int x = rect.left(); x <= rect.right(); ++x) {
+			*(uint32_t *) &(overlay_image_buffer[(x + y * this->minimap_texture_width[z]) * 4]) = color;
+		}
+	}
+}
+
+//fill the parts of the overlay outside the map area with black
+void minimap::draw_overlay_border(const QRect &clip_rect, const int z)
+{
+	const int texture_width = this->get_texture_width(z);
+	const int texture_height = this->get_texture_height(z);
+	const QRect rect = clip_rect.intersected(QRect(0, 0, texture_width, texture_height));
+
+	unsigned char *overlay_image_buffer = this->overlay_textures[z]->get_image().bits();
+
+	for (int my = rect.top(); my <= rect.bottom(); ++my) {
+		for (int mx = rect.left(); mx <= rect.right(); ++mx) {
+			if (mx < XOffset[z] || mx >= texture_width - XOffset[z] || my < YOffset[z] || my >= texture_height - YOffset[z]) {
+				*(uint32_t *) &(overlay_image_buffer[(mx + my * this->minimap_texture_width[z]) * 4]) = CVideo::MapRGB(0, 0, 0);
+			}
+		}
+	}
+}
+
+//restore the overlay to how it is without any units drawn on it, within the given rectangle
+void minimap::restore_overlay_base(const QRect &rect, const int z)
+{
+	QImage &overlay_image = this->overlay_textures[z]->get_image();
+	const QRect clipped_rect = rect.intersected(overlay_image.rect());
+
+	if (minimap_mode_has_overlay(this->get_mode())) {
+		const QImage &mode_overlay_image = this->mode_overlay_images[this->get_mode()][z];
+
+		for (int y = clipped_rect.top(); y <= clipped_rect.bottom(); ++y) {
+			memcpy(overlay_image.scanLine(y) + clipped_rect.left() * 4, mode_overlay_image.constScanLine(y) + clipped_rect.left() * 4, clipped_rect.width() * 4);
+		}
+	} else {
+		for (int y = clipped_rect.top(); y <= clipped_rect.bottom(); ++y) {
+			memset(overlay_image.scanLine(y) + clipped_rect.left() * 4, 0, clipped_rect.width() * 4);
+		}
+	}
 
-	painter.drawEllipse(x, y, type->get_tile_width() + 1, type->get_tile_height() + 1);
+	this->draw_overlay_border(clipped_rect, z);
+}
+
+void minimap::mark_overlay_base_dirty(const QRect &rect, const int z)
+{
+	if (rect.isEmpty()) {
+		return;
+	}
+
+	std::vector<QRect> &dirty_rects = this->overlay_base_dirty_rects[z];
+
+	if (dirty_rects.size() >= MAX_OVERLAY_DIRTY_RECTS) {
+		//too many changes accumulated, e.g. while the map layer was not being shown, so just treat the whole overlay as changed
+		dirty_rects.clear();
+		dirty_rects.push_back(this->overlay_textures[z]->get_image().rect());
+		return;
+	}
+
+	dirty_rects.push_back(rect);
 }
 
 /**
@@ -608,48 +795,69 @@ void minimap::Update()
 
 	const int z = UI.CurrentMapLayer->ID;
 
-	//clear Minimap background if not transparent
-	if (!this->Transparent) {
-		this->overlay_images[z].fill(Qt::transparent);
-	}
+	std::vector<std::pair<const CUnit *, minimap_unit_mark>> unit_marks = this->get_unit_marks(red_phase);
 
-	if (minimap_mode_has_overlay(this->get_mode())) {
-		this->overlay_images[z] = this->mode_overlay_images[this->get_mode()][z];
-	}
+	//a transparent minimap keeps what was drawn before, so it is always redrawn entirely
+	bool full_redraw = this->Transparent || z != this->unit_marks_z || this->get_mode() != this->unit_marks_mode;
 
-	const int texture_width = this->get_texture_width(z);
-	const int texture_height = this->get_texture_height(z);
-	unsigned char *overlay_image_buffer = this->overlay_images[z].bits();
+	std::vector<QRect> dirty_rects;
+	if (!full_redraw) {
+		dirty_rects = this->get_changed_unit_mark_rects(unit_marks);
 
-	for (int my = 0; my < texture_height; ++my) {
-		for (int mx = 0; mx < texture_width; ++mx) {
-			if (mx < XOffset[z] || mx >= texture_width - XOffset[z] || my < YOffset[z] || my >= texture_height - YOffset[z]) {
-				*(uint32_t *) &(overlay_image_buffer[(mx + my * this->minimap_texture_width[z]) * 4]) = CVideo::MapRGB(0, 0, 0);
-			}
+		if (minimap_mode_has_overlay(this->get_mode())) {
+			vector::merge(dirty_rects, this->overlay_base_dirty_rects[z]);
+		}
+
+		if (dirty_rects.size() > MAX_OVERLAY_DIRTY_RECTS) {
+			full_redraw = true;
 		}
 	}
 
-	if (this->are_units_visible()) {
-		//draw units on the map
-		for (const CUnit *unit : unit_manager::get()->get_units()) {
-			if (unit->IsVisibleOnMinimap()) {
-				this->draw_unit(unit, red_phase);
-			}
+	this->overlay_base_dirty_rects[z].clear();
+
+	minimap_texture *overlay_texture = this->overlay_textures[z].get();
+	QImage &overlay_image = overlay_texture->get_image();
+
+	if (full_redraw) {
+		//clear Minimap background if not transparent
+		if (!this->Transparent) {
+			overlay_image.fill(Qt::transparent);
 		}
+
+		if (minimap_mode_has_overlay(this->get_mode())) {
+			overlay_image = this->mode_overlay_images[this->get_mode()][z];
+		}
+
+		this->draw_overlay_border(overlay_image.rect(), z);
+
+		for (const auto &[unit, mark] : unit_marks) {
+			this->draw_unit_mark(mark, overlay_image.rect(), z);
+		}
+
+		overlay_texture->mark_all_dirty();
 	} else {
-		//when drawing only terrain, draw celestial body units on their center tile
-		for (const CUnit *unit : unit_manager::get()->get_units()) {
-			if (!unit->Type->BoolFlag[CELESTIAL_BODY_INDEX].value && !unit->Type->BoolFlag[ASTEROID_INDEX].value) {
+		//only redraw the changed parts of the overlay, including any unchanged units which overlap them
+		for (const QRect &dirty_rect : dirty_rects) {
+			const QRect rect = dirty_rect.intersected(overlay_image.rect());
+			if (rect.isEmpty()) {
 				continue;
 			}
 
-			if (!unit->IsVisibleOnMinimap()) {
-				continue;
+			this->restore_overlay_base(rect, z);
+
+			for (const auto &[unit, mark] : unit_marks) {
+				if (mark.get_covered_rect().intersects(rect)) {
+					this->draw_unit_mark(mark, rect, z);
+				}
 			}
 
-			this->draw_terrain_unit(unit, red_phase);
+			overlay_texture->mark_dirty(rect);
 		}
 	}
+
+	this->unit_marks = std::move(unit_marks);
+	this->unit_marks_z = z;
+	this->unit_marks_mode = this->get_mode();
 }
 
 void minimap::draw_events(std::vector<std::function<void(renderer *)>> &render_commands) const
@@ -684,38 +892,29 @@ void minimap::draw_events(std::vector<std::function<void(renderer *)>> &render_c
 	}
 }
 
-void minimap::Draw(std::vector<std::function<void(renderer *)>> &render_commands) const
+void minimap::Draw(std::vector<std::function<void(renderer *)>> &render_commands)
 {
 	const int z = UI.CurrentMapLayer->ID;
 
 	if (this->is_terrain_visible()) {
-		this->draw_image(this->terrain_images.at(z), z, render_commands);
+		this->draw_texture(*this->terrain_textures.at(z), z, render_commands);
 	}
 
 	if (this->is_fog_of_war_visible()) {
-		this->draw_image(this->fog_of_war_images.at(z), z, render_commands);
+		this->draw_texture(*this->fog_of_war_textures.at(z), z, render_commands);
 	}
 
-	this->draw_image(this->overlay_images.at(z), z, render_commands);
-	this->draw_image(this->unexplored_images.at(z), z, render_commands);
+	this->draw_texture(*this->overlay_textures.at(z), z, render_commands);
+	this->draw_texture(*this->unexplored_textures.at(z), z, render_commands);
 
 	this->draw_events(render_commands);
 }
 
-void minimap::draw_image(const QImage &image, const int z, std::vector<std::function<void(renderer *)>> &render_commands) const
+void minimap::draw_texture(minimap_texture &texture, const int z, std::vector<std::function<void(renderer *)>> &render_commands) const
 {
-	QRect rect = this->get_texture_draw_rect(z);
+	const QRect rect = this->get_texture_draw_rect(z);
 
-	render_commands.push_back([this, image, z, rect](renderer *renderer) {
-		if (image.isNull()) {
-			log::log_error("Minimap image is null.");
-			return;
-		}
-
-		QOpenGLTexture texture(image);
-
-		renderer->blit_texture_frame(&texture, QPoint(X, Y), rect.topLeft(), rect.size(), false, 255, 100, QSize(W, H));
-	});
+	texture.draw(QPoint(this->X, this->Y), rect, QSize(this->W, this->H), render_commands);
 }
 
 QPoint minimap::texture_to_tile_pos(const QPoint &texture_pos) const
@@ -786,11 +985,15 @@ QPoint minimap::tile_to_screen_pos(const QPoint &tile_pos) const
 */
 void minimap::Destroy()
 {
-	this->terrain_images.clear();
-	this->overlay_images.clear();
+	this->terrain_textures.clear();
+	this->overlay_textures.clear();
 	this->mode_overlay_images.clear();
-	this->unexplored_images.clear();
-	this->fog_of_war_images.clear();
+	this->unexplored_textures.clear();
+	this->fog_of_war_textures.clear();
+	this->overlay_base_dirty_rects.clear();
+
+	this->unit_marks.clear();
+	this->unit_marks_z = -1;
 
 	this->minimap_to_map_x.clear();
 	this->minimap_to_map_y.clear();
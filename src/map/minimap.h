@@ -36,9 +36,30 @@ typedef unsigned int GLuint;
 
 namespace wyrmgus {
 
+class minimap_texture;
 class unit_type;
 enum class minimap_mode;
 
+//the pixels a unit occupies in the minimap overlay, used to redraw only the units which changed
+struct minimap_unit_mark final
+{
+	QRect get_covered_rect() const
+	{
+		if (this->ellipse) {
+			//account for the antialiased outline
+			return this->rect.adjusted(-1, -1, 1, 1);
+		}
+
+		return this->rect;
+	}
+
+	bool operator==(const minimap_unit_mark &other) const = default;
+
+	QRect rect;
+	QColor color;
+	bool ellipse = false; //whether the unit is drawn as a circle on its center tile, rather than as a filled rectangle
+};
+
 class minimap final
 {
 public:
@@ -46,6 +67,7 @@ public:
 	static constexpr QColor fog_of_war_color = QColor(0, 0, 0, 128);
 
 	minimap();
+	~minimap();
 
 private:
 	void UpdateTerrain(int z);
@@ -63,8 +85,8 @@ public:
 	void Update();
 	void Create();
 	void Destroy();
-	void Draw(std::vector<std::function<void(renderer *)>> &render_commands) const;
-	void draw_image(const QImage &image, const int z, std::vector<std::function<void(renderer *)>> &render_commands) const;
+	void Draw(std::vector<std::function<void(renderer *)>> &render_commands);
+	void draw_texture(minimap_texture &texture, const int z, std::vector<std::function<void(renderer *)>> &render_commands) const;
 	void DrawViewportArea(const CViewport &viewport, std::vector<std::function<void(renderer *)>> &render_commands) const;
 
 private:
@@ -72,8 +94,15 @@ private:
 	uint32_t get_unit_minimap_color(const CUnit *unit, const unit_type *type, const bool red_phase) const;
 	QColor get_terrain_unit_minimap_color(const CUnit *unit, const unit_type *type, const bool red_phase) const;
 
-	void draw_unit(const CUnit *unit, const bool red_phase);
-	void draw_terrain_unit(const CUnit *unit, const bool red_phase);
+	std::optional<minimap_unit_mark> get_unit_mark(const CUnit *unit, const bool red_phase) const;
+	std::optional<minimap_unit_mark> get_terrain_unit_mark(const CUnit *unit, const bool red_phase) const;
+	std::vector<std::pair<const CUnit *, minimap_unit_mark>> get_unit_marks(const bool red_phase) const;
+	std::vector<QRect> get_changed_unit_mark_rects(const std::vector<std::pair<const CUnit *, minimap_unit_mark>> &unit_marks) const;
+
+	void draw_unit_mark(const minimap_unit_mark &mark, const QRect &clip_rect, const int z);
+	void draw_overlay_border(const QRect &clip_rect, const int z);
+	void restore_overlay_base(const QRect &rect, const int z);
+	void mark_overlay_base_dirty(const QRect &rect, const int z);
 
 public:
 	void AddEvent(const Vec2i &pos, int z, IntColor color);
@@ -166,18 +195,26 @@ public:
 private:
 	minimap_mode mode;
 	bool zoomed = false; //whether the minimap texture is being shown at full resolution
-	std::vector<QImage> terrain_images;
+	std::vector<std::unique_ptr<minimap_texture>> terrain_textures;
 
-	//image for unexplored tiles
-	std::vector<QImage> unexplored_images;
+	//texture for unexplored tiles
+	std::vector<std::unique_ptr<minimap_texture>> unexplored_textures;
 
-	//image for tiles under fog of war
-	std::vector<QImage> fog_of_war_images;
+	//texture for tiles under fog of war
+	std::vector<std::unique_ptr<minimap_texture>> fog_of_war_textures;
 
-	//image for the overlay with units
-	std::vector<QImage> overlay_images;
+	//texture for the overlay with units
+	std::vector<std::unique_ptr<minimap_texture>> overlay_textures;
 
 	std::map<minimap_mode, std::vector<QImage>> mode_overlay_images;
+
+	//the parts of the mode overlay images which changed since they were last copied to the overlay texture, per map layer
+	std::vector<std::vector<QRect>> overlay_base_dirty_rects;
+
+	//the units drawn on the overlay texture at the last update, in drawing order
+	std::vector<std::pair<const CUnit *, minimap_unit_mark>> unit_marks;
+	int unit_marks_z = -1;
+	minimap_mode unit_marks_mode;
 };
 
 }
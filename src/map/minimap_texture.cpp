@@ -0,0 +1,173 @@
+//       _________ __                 __
+//      /   _____//  |_____________ _/  |______     ____  __ __  ______
+//      \_____  \\   __\_  __ \__  \\   __\__  \   / ___\|  |  \/  ___/
+//      /        \|  |  |  | \// __ \|  |  / __ \_/ /_/  >  |  /\___ |
+//     /_______  /|__|  |__|  (____  /__| (____  /\___  /|____//____  >
+//             \/                  \/          \//_____/            \/
+//  ______________________                           ______________________
+//                        T H E   W A R   B E G I N S
+//         Stratagus - A free fantasy real time strategy game engine
+//
+//      (c) Copyright 2026 by Andrettin
+//
+//      This program is free software; you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation; only version 2 of the License.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program; if not, write to the Free Software
+//      Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+//      02111-1307, USA.
+
+#include "stratagus.h"
+
+#include "map/minimap_texture.h"
+
+#include "util/log_util.h"
+#include "video/render_context.h"
+#include "video/renderer.h"
+
+#pragma warning(push, 0)
+#include <QOpenGLPixelTransferOptions>
+#include <QOpenGLTexture>
+#pragma warning(pop)
+
+namespace wyrmgus {
+
+class minimap_texture::texture_state final
+{
+public:
+	~texture_state()
+	{
+		if (this->texture == nullptr) {
+			return;
+		}
+
+		//the texture can only be destroyed in the render thread
+		std::shared_ptr<QOpenGLTexture> texture = std::move(this->texture);
+		render_context::get()->add_free_texture_command([texture]() mutable {
+			texture.reset();
+		});
+	}
+
+	const QOpenGLTexture *get_texture() const
+	{
+		return this->texture.get();
+	}
+
+	void update(const QImage &image, const std::vector<QRect> &dirty_rects, const uint64_t sequence)
+	{
+		if (sequence == this->uploaded_sequence && this->texture != nullptr) {
+			//the same command being run again, e.g. because the window was resized
+			return;
+		}
+
+		//if a draw command was skipped, its changes were never uploaded, so the whole image has to be uploaded again
+		if (this->texture == nullptr || sequence != this->uploaded_sequence + 1 || this->texture->width() != image.width() || this->texture->height() != image.height()) {
+			this->texture = std::make_shared<QOpenGLTexture>(image);
+		} else if (!dirty_rects.empty()) {
+			QOpenGLPixelTransferOptions options;
+			options.setRowLength(image.bytesPerLine() / 4);
+			options.setAlignment(4);
+
+			for (const QRect &rect : dirty_rects) {
+				const uchar *data = image.constBits() + rect.y() * image.bytesPerLine() + rect.x() * 4;
+				this->texture->setData(rect.x(), rect.y(), 0, rect.width(), rect.height(), 1, QOpenGLTexture::RGBA, QOpenGLTexture::UInt8, data, &options);
+			}
+
+			if (this->texture->mipLevels() > 1) {
+				this->texture->generateMipMaps();
+			}
+		}
+
+		this->uploaded_sequence = sequence;
+	}
+
+private:
+	std::shared_ptr<QOpenGLTexture> texture;
+	uint64_t uploaded_sequence = 0;
+};
+
+minimap_texture::minimap_texture(QImage &&image)
+	: image(std::move(image)), state(std::make_shared<texture_state>())
+{
+	this->dirty_block_columns = (this->image.width() + minimap_texture::dirty_block_size - 1) / minimap_texture::dirty_block_size;
+	this->dirty_block_rows = (this->image.height() + minimap_texture::dirty_block_size - 1) / minimap_texture::dirty_block_size;
+	this->dirty_blocks.resize(this->dirty_block_columns * this->dirty_block_rows, true);
+}
+
+void minimap_texture::mark_dirty(const QRect &rect)
+{
+	const QRect clipped_rect = rect.intersected(this->image.rect());
+	if (clipped_rect.isEmpty()) {
+		return;
+	}
+
+	const int start_column = clipped_rect.left() / minimap_texture::dirty_block_size;
+	const int end_column = clipped_rect.right() / minimap_texture::dirty_block_size;
+	const int start_row = clipped_rect.top() / minimap_texture::dirty_block_size;
+	const int end_row = clipped_rect.bottom() / minimap_texture::dirty_block_size;
+
+	for (int row = start_row; row <= end_row; ++row) {
+		for (int column = start_column; column <= end_column; ++column) {
+			this->dirty_blocks[column + row * this->dirty_block_columns] = true;
+		}
+	}
+}
+
+void minimap_texture::mark_all_dirty()
+{
+	std::fill(this->dirty_blocks.begin(), this->dirty_blocks.end(), true);
+}
+
+std::vector<QRect> minimap_texture::take_dirty_rects()
+{
+	std::vector<QRect> dirty_rects;
+
+	//merge horizontally adjacent dirty blocks into a single rectangle
+	for (int row = 0; row < this->dirty_block_rows; ++row) {
+		int run_start = -1;
+
+		for (int column = 0; column <= this->dirty_block_columns; ++column) {
+			const bool dirty = column < this->dirty_block_columns && this->dirty_blocks[column + row * this->dirty_block_columns];
+
+			if (dirty) {
+				this->dirty_blocks[column + row * this->dirty_block_columns] = false;
+
+				if (run_start == -1) {
+					run_start = column;
+				}
+			} else if (run_start != -1) {
+				const QRect rect(run_start * minimap_texture::dirty_block_size, row * minimap_texture::dirty_block_size, (column - run_start) * minimap_texture::dirty_block_size, minimap_texture::dirty_block_size);
+				dirty_rects.push_back(rect.intersected(this->image.rect()));
+				run_start = -1;
+			}
+		}
+	}
+
+	return dirty_rects;
+}
+
+void minimap_texture::draw(const QPoint &pos, const QRect &source_rect, const QSize &rendered_size, std::vector<std::function<void(renderer *)>> &render_commands)
+{
+	std::vector<QRect> dirty_rects = this->take_dirty_rects();
+	++this->draw_sequence;
+
+	render_commands.push_back([state = this->state, image = this->image, dirty_rects = std::move(dirty_rects), sequence = this->draw_sequence, pos, source_rect, rendered_size](renderer *renderer) {
+		if (image.isNull()) {
+			log::log_error("Minimap image is null.");
+			return;
+		}
+
+		state->update(image, dirty_rects, sequence);
+
+		renderer->blit_texture_frame(state->get_texture(), pos, source_rect.topLeft(), source_rect.size(), false, 255, 100, rendered_size);
+	});
+}
+
+}
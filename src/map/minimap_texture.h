@@ -0,0 +1,70 @@
+//       _________ __                 __
+//      /   _____//  |_____________ _/  |______     ____  __ __  ______
+//      \_____  \\   __\_  __ \__  \\   __\__  \   / ___\|  |  \/  ___/
+//      /        \|  |  |  | \// __ \|  |  / __ \_/ /_/  >  |  /\___ |
+//     /_______  /|__|  |__|  (____  /__| (____  /\___  /|____//____  >
+//             \/                  \/          \//_____/            \/
+//  ______________________                           ______________________
+//                        T H E   W A R   B E G I N S
+//         Stratagus - A free fantasy real time strategy game engine
+//
+//      (c) Copyright 2026 by Andrettin
+//
+//      This program is free software; you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation; only version 2 of the License.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program; if not, write to the Free Software
+//      Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+//      02111-1307, USA.
+
+#pragma once
+
+namespace wyrmgus {
+
+class renderer;
+
+//a minimap image together with the texture used to draw it; the texture is kept between frames, and only the parts of the image which changed since the last draw are uploaded again
+class minimap_texture final
+{
+public:
+	static constexpr int dirty_block_size = 32;
+
+	explicit minimap_texture(QImage &&image);
+
+	const QImage &get_image() const
+	{
+		return this->image;
+	}
+
+	//the caller is responsible for marking the parts of the image it changes as dirty
+	QImage &get_image()
+	{
+		return this->image;
+	}
+
+	void mark_dirty(const QRect &rect);
+	void mark_all_dirty();
+
+	void draw(const QPoint &pos, const QRect &source_rect, const QSize &rendered_size, std::vector<std::function<void(renderer *)>> &render_commands);
+
+private:
+	std::vector<QRect> take_dirty_rects();
+
+	class texture_state;
+
+	QImage image;
+	int dirty_block_columns = 0;
+	int dirty_block_rows = 0;
+	std::vector<bool> dirty_blocks;
+	uint64_t draw_sequence = 0; //incremented each time a draw command is created, so that the render thread can detect skipped commands
+	std::shared_ptr<texture_state> state; //the texture and its upload state, only accessed from the render thread
+};
+
+}
@@ -0,0 +1,63 @@
+//       _________ __                 __
+//      /   _____//  |_____________ _/  |______     ____  __ __  ______
+//      \_____  \\   __\_  __ \__  \\   __\__  \   / ___\|  |  \/  ___/
+//      /        \|  |  |  | \// __ \|  |  / __ \_/ /_/  >  |  /\___ |
+//     /_______  /|__|  |__|  (____  /__| (____  /\___  /|____//____  >
+//             \/                  \/          \//_____/            \/
+//  ______________________                           ______________________
+//                        T H E   W A R   B E G I N S
+//         Stratagus - A free fantasy real time strategy game engine
+//
+//      (c) Copyright 2026 by Andrettin
+//
+//      This program is free software; you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation; only version 2 of the License.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program; if not, write to the Free Software
+//      Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+//      02111-1307, USA.
+
+#include "stratagus.h"
+
+#include "map/random_position_sampler.h"
+
+#include "util/assert_util.h"
+#include "util/random.h"
+
+namespace wyrmgus {
+
+random_position_sampler::random_position_sampler(const QRect &rect) : rect(rect)
+{
+	if (!rect.isEmpty()) {
+		this->remaining_count = rect.width() * rect.height();
+	}
+}
+
+QPoint random_position_sampler::take_random()
+{
+	assert_throw(!this->is_empty());
+
+	const int shuffle_index = random::get()->generate(this->remaining_count);
+	const int last_shuffle_index = this->remaining_count - 1;
+
+	const int index = this->get_index(shuffle_index);
+
+	//move the position at the last shuffle index to the drawn one, so that the remaining positions are always those in the range before the last index
+	if (shuffle_index != last_shuffle_index) {
+		this->swapped_indices[shuffle_index] = this->get_index(last_shuffle_index);
+	}
+	this->swapped_indices.erase(last_shuffle_index);
+
+	--this->remaining_count;
+
+	return QPoint(this->rect.x() + index % this->rect.width(), this->rect.y() + index / this->rect.width());
+}
+
+}
@@ -0,0 +1,61 @@
+//       _________ __                 __
+//      /   _____//  |_____________ _/  |______     ____  __ __  ______
+//      \_____  \\   __\_  __ \__  \\   __\__  \   / ___\|  |  \/  ___/
+//      /        \|  |  |  | \// __ \|  |  / __ \_/ /_/  >  |  /\___ |
+//     /_______  /|__|  |__|  (____  /__| (____  /\___  /|____//____  >
+//             \/                  \/          \//_____/            \/
+//  ______________________                           ______________________
+//                        T H E   W A R   B E G I N S
+//         Stratagus - A free fantasy real time strategy game engine
+//
+//      (c) Copyright 2026 by Andrettin
+//
+//      This program is free software; you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation; only version 2 of the License.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program; if not, write to the Free Software
+//      Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+//      02111-1307, USA.
+
+#pragma once
+
+namespace wyrmgus {
+
+//draws the positions in a rectangle in a random order without repetition, using the synchronized random number generator
+//this is a lazy Fisher-Yates shuffle: positions are only generated as they are drawn, instead of building a vector with all positions in the rectangle beforehand
+class random_position_sampler final
+{
+public:
+	explicit random_position_sampler(const QRect &rect);
+
+	bool is_empty() const
+	{
+		return this->remaining_count == 0;
+	}
+
+	QPoint take_random();
+
+private:
+	int get_index(const int shuffle_index) const
+	{
+		const auto find_iterator = this->swapped_indices.find(shuffle_index);
+		if (find_iterator != this->swapped_indices.end()) {
+			return find_iterator->second;
+		}
+
+		return shuffle_index;
+	}
+
+	QRect rect;
+	int remaining_count = 0;
+	std::unordered_map<int, int> swapped_indices; //the position indices which have been moved to a shuffle index other than their own
+};
+
+}
@@ -33,6 +33,7 @@
 #include "map/site_history.h"
 #include "map/terrain_feature.h"
 #include "util/container_util.h"
+#include "util/stage_timer.h"
 #include "util/vector_util.h"
 
 namespace wyrmgus {
@@ -44,9 +45,23 @@ const std::set<std::string> region::history_database_dependencies = {
 
 void region::load_history_database(const QDate &start_date, const timeline *current_timeline, const game_rules_base *game_rules)
 {
+	stage_timer timer;
+
 	data_type::load_history_database(start_date, current_timeline, game_rules);
 
-	std::vector<region *> regions = region::get_all();
+	timer.print("Region history loading");
+
+	timer.restart();
+
+	//only regions with population in their history have any population to distribute
+	std::vector<region *> regions;
+	for (region *region : region::get_all()) {
+		const region_history *region_history = region->get_history();
+
+		if (region_history->get_population() != 0 || !region_history->get_population_groups().empty()) {
+			regions.push_back(region);
+		}
+	}
 
 	std::sort(regions.begin(), regions.end(), [](const region *lhs, const region *rhs) {
 		//give priority to smaller regions
@@ -61,6 +76,8 @@ void region::load_history_database(const QDate &start_date, const timeline *curr
 		region->distribute_population();
 		region->distribute_population_groups();
 	}
+
+	timer.print("Region population distribution");
 }
 
 region::region(const std::string &identifier) : data_entry(identifier)
@@ -33,6 +33,7 @@
 #include "character.h"
 #include "database/defines.h"
 #include "database/preferences.h"
+#include "economy/resource_source_index.h"
 #include "editor.h"
 #include "game/game.h"
 #include "iolib.h"
@@ -73,6 +74,7 @@
 #include "util/exception_util.h"
 #include "util/log_util.h"
 #include "util/point_util.h"
+#include "util/stage_timer.h"
 #include "util/util.h"
 #include "video/video.h"
 
@@ -520,6 +522,7 @@ void SetTileTerrain(const std::string &terrain_ident, const Vec2i &pos, int valu
 
 		mf.set_value(value);
 		mf.SetTerrain(terrain);
+		CMap::get()->MapLayers[z]->get_resource_source_index()->on_tile_changed(pos);
 	}
 }
 
@@ -825,7 +828,9 @@ void ApplyCampaignMap(const std::string &campaign_ident)
 
 		const campaign *campaign = campaign::get(campaign_ident);
 
+		stage_timer timer;
 		database::get()->load_history(campaign->get_start_date(), campaign->get_timeline());
+		timer.print("History loading");
 
 		for (size_t i = 0; i < campaign->get_map_templates().size(); ++i) {
 			map_template *map_template = campaign->get_map_templates()[i];
@@ -834,11 +839,15 @@ void ApplyCampaignMap(const std::string &campaign_ident)
 				start_pos = campaign->MapTemplateStartPos[i];
 			}
 
+			timer.restart();
+
 			try {
 				map_template->apply(start_pos, QPoint(0, 0), i);
 			} catch (...) {
 				std::throw_with_nested(std::runtime_error("Failed to apply map template \"" + map_template->get_identifier() + "\"."));
 			}
+
+			timer.print("Map template \"" + map_template->get_identifier() + "\" application");
 		}
 	} catch (...) {
 		exception::report(std::current_exception());
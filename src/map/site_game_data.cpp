@@ -99,6 +99,7 @@ void site_game_data::process_gsml_scope(const gsml_data &scope)
 			auto population_unit = make_qunique<wyrmgus::population_unit>();
 			population_unit->moveToThread(QApplication::instance()->thread());
 			child_scope.process(population_unit.get());
+			this->on_population_unit_population_changed(population_unit.get(), population_unit->get_population());
 			this->population_units.push_back(std::move(population_unit));
 		});
 	} else {
@@ -162,12 +163,21 @@ gsml_data site_game_data::to_gsml_data() const
 void site_game_data::do_per_half_minute_loop()
 {
 	if (defines::get()->is_population_enabled() && this->site->is_settlement()) {
+		//the population steps can create and remove many population units, so notify the interface only once at the end
+		this->population_units_changed_deferred = true;
+
 		this->do_population_growth();
 		this->do_population_promotion();
 		this->do_population_demotion();
 		this->do_population_employment();
 
 		this->sort_population_units();
+
+		this->population_units_changed_deferred = false;
+
+		if (this->population_units_changed_pending) {
+			this->on_population_units_changed();
+		}
 	}
 }
 
@@ -547,11 +557,12 @@ void site_game_data::create_population_unit(const population_unit_key &key, cons
 {
 	auto population_unit = make_qunique<wyrmgus::population_unit>(key, population);
 	population_unit->moveToThread(QApplication::instance()->thread());
+	this->on_population_unit_population_changed(population_unit.get(), population);
 	this->population_units.push_back(std::move(population_unit));
 
 	this->change_population(population);
 
-	emit population_units_changed(this->get_population_units_qvariant_list());
+	this->on_population_units_changed();
 }
 
 void site_game_data::remove_population_unit(const population_unit_key &key)
@@ -561,9 +572,10 @@ void site_game_data::remove_population_unit(const population_unit_key &key)
 
 		if (population_unit->get_key() == key) {
 			this->change_population(-population_unit->get_population());
+			this->on_population_unit_population_changed(population_unit.get(), -population_unit->get_population());
 			this->population_units.erase(this->population_units.begin() + i);
 
-			emit population_units_changed(this->get_population_units_qvariant_list());
+			this->on_population_units_changed();
 
 			return;
 		}
@@ -573,8 +585,41 @@ void site_game_data::remove_population_unit(const population_unit_key &key)
 void site_game_data::clear_population_units()
 {
 	this->population_units.clear();
+	this->population_type_populations.clear();
+	this->employment_workforces.clear();
 	this->set_population(0);
 
+	this->on_population_units_changed();
+}
+
+void site_game_data::on_population_unit_population_changed(const population_unit *population_unit, const int64_t change)
+{
+	if (change == 0) {
+		return;
+	}
+
+	const int64_t type_population = (this->population_type_populations[population_unit->get_type()] += change);
+	if (type_population == 0) {
+		this->population_type_populations.erase(population_unit->get_type());
+	}
+
+	if (population_unit->get_employment_type() != nullptr) {
+		const int64_t workforce = (this->employment_workforces[population_unit->get_employment_type()] += change);
+		if (workforce == 0) {
+			this->employment_workforces.erase(population_unit->get_employment_type());
+		}
+	}
+}
+
+void site_game_data::on_population_units_changed()
+{
+	if (this->population_units_changed_deferred) {
+		this->population_units_changed_pending = true;
+		return;
+	}
+
+	this->population_units_changed_pending = false;
+
 	emit population_units_changed(this->get_population_units_qvariant_list());
 }
 
@@ -590,6 +635,7 @@ void site_game_data::set_population_unit_population(const population_unit_key &k
 		const int64_t old_population = population_unit->get_population();
 		population_unit->set_population(population);
 		this->change_population(population - old_population);
+		this->on_population_unit_population_changed(population_unit, population - old_population);
 		return;
 	}
 
@@ -614,6 +660,7 @@ void site_game_data::change_population_unit_population(population_unit *populati
 {
 	population_unit->change_population(change);
 	this->change_population(change);
+	this->on_population_unit_population_changed(population_unit, change);
 
 	if (population_unit->get_population() <= 0) {
 		this->remove_population_unit(population_unit->get_key());
@@ -622,15 +669,12 @@ void site_game_data::change_population_unit_population(population_unit *populati
 
 int64_t site_game_data::get_population_type_population(const population_type *population_type) const
 {
-	int64_t population = 0;
-
-	for (const qunique_ptr<population_unit> &population_unit : this->population_units) {
-		if (population_unit->get_type() == population_type) {
-			population += population_unit->get_population();
-		}
+	const auto find_iterator = this->population_type_populations.find(population_type);
+	if (find_iterator != this->population_type_populations.end()) {
+		return find_iterator->second;
 	}
 
-	return population;
+	return 0;
 }
 
 void site_game_data::change_population_type_population(const population_type *population_type, const int64_t change)
@@ -1070,7 +1114,7 @@ void site_game_data::sort_population_units()
 		return population_unit::compare(lhs.get(), rhs.get());
 	});
 
-	emit population_units_changed(this->get_population_units_qvariant_list());
+	this->on_population_units_changed();
 }
 
 const population_type *site_game_data::get_class_population_type(const population_class *population_class) const
@@ -1082,19 +1126,6 @@ const population_type *site_game_data::get_class_population_type(const populatio
 	return this->owner->get_class_population_type(population_class);
 }
 
-int64_t site_game_data::get_employment_workforce(const employment_type *employment_type) const
-{
-	int64_t workforce = 0;
-
-	for (const qunique_ptr<population_unit> &population_unit : this->population_units) {
-		if (population_unit->get_employment_type() == employment_type) {
-			workforce += population_unit->get_population();
-		}
-	}
-
-	return workforce;
-}
-
 void site_game_data::on_civilization_changed()
 {
 	std::vector<population_unit *> population_units_to_convert;
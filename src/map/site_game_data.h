@@ -29,6 +29,7 @@
 #include "economy/resource_container.h"
 #include "map/site_container.h"
 #include "population/employment_type_container.h"
+#include "population/population_type_container.h"
 #include "util/qunique_ptr.h"
 
 class CMapLayer;
@@ -265,6 +266,12 @@ public:
 	void remove_population_unit(const population_unit_key &key);
 	void clear_population_units();
 
+private:
+	void on_population_unit_population_changed(const population_unit *population_unit, const int64_t change);
+	void on_population_units_changed();
+
+public:
+
 	void set_population_unit_population(const population_unit_key &key, const int64_t population);
 	void change_population_unit_population(const population_unit_key &key, const int64_t change);
 
@@ -367,7 +374,15 @@ public:
 		this->set_employment_capacity(employment_type, this->get_employment_capacity(employment_type) + change);
 	}
 
-	int64_t get_employment_workforce(const employment_type *employment_type) const;
+	int64_t get_employment_workforce(const employment_type *employment_type) const
+	{
+		const auto find_iterator = this->employment_workforces.find(employment_type);
+		if (find_iterator != this->employment_workforces.end()) {
+			return find_iterator->second;
+		}
+
+		return 0;
+	}
 
 	int get_employment_income(const resource *resource) const
 	{
@@ -413,6 +428,10 @@ private:
 	site_set border_settlements; //other settlements bordering this one
 	int64_t population = 0;
 	std::vector<qunique_ptr<population_unit>> population_units;
+	population_type_map<int64_t> population_type_populations; //population of each population type, kept up to date as population units change
+	employment_type_map<int64_t> employment_workforces; //workforce of each employment type, kept up to date as population units change
+	bool population_units_changed_deferred = false; //whether population unit change notifications are being held back until the end of the population loop
+	bool population_units_changed_pending = false;
 	int housing = 0;
 	employment_type_map<int> employment_capacities;
 	resource_map<int> employment_incomes; //resource incomes happening as a result of employment
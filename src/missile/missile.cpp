@@ -713,11 +713,11 @@ void FireMissile(CUnit &unit, CUnit *goal, const Vec2i &goalPos, int z)
 			if (CMap::get()->WallOnMap(goalPos, z)) {
 				//Wyrmgus start
 //				if (CMap::get()->HumanWallOnMap(goalPos)) {
-				if (CMap::get()->Field(goalPos, z)->get_overlay_terrain()->get_unit_type() && CalculateHit(unit, *CMap::get()->Field(goalPos, z)->get_overlay_terrain()->get_unit_type()->Stats, nullptr) == true) {
+				if (CMap::get()->Field(goalPos, z)->get_overlay_terrain()->get_unit_type() && CalculateHit(unit, *CMap::get()->Field(goalPos, z)->get_overlay_terrain()->get_unit_type()->Stats[0], nullptr) == true) {
 				//Wyrmgus end
 					//Wyrmgus start
 					PlayUnitSound(&unit, wyrmgus::unit_sound_type::hit);
-					damage = CalculateDamageStats(unit, *CMap::get()->Field(goalPos, z)->get_overlay_terrain()->get_unit_type()->Stats, nullptr);
+					damage = CalculateDamageStats(unit, *CMap::get()->Field(goalPos, z)->get_overlay_terrain()->get_unit_type()->Stats[0], nullptr);
 					//Wyrmgus end
 					CMap::get()->HitWall(goalPos,
 								//Wyrmgus start
@@ -1342,7 +1342,7 @@ static void MissileHitsWall(const Missile &missile, const Vec2i &tilePos, int sp
 		return;
 	}
 	
-	const unit_stats *stats = CMap::get()->Field(tilePos, missile.MapLayer)->get_overlay_terrain()->get_unit_type()->Stats;
+	const unit_stats *stats = &CMap::get()->Field(tilePos, missile.MapLayer)->get_overlay_terrain()->get_unit_type()->Stats[0];
 	
 	if (missile.Damage || missile.LightningDamage) {  // direct damage, spells mostly
 		int damage = missile.Damage / splash;
@@ -527,6 +527,45 @@ size_t CNetworkCommandQuit::Deserialize(const unsigned char *buf)
 	return p - buf;
 }
 
+// CNetworkCommandGroup
+
+size_t CNetworkCommandGroup::Serialize(unsigned char *buf) const
+{
+	unsigned char *p = buf;
+
+	p += serialize8(p, this->Type);
+	p += serialize16(p, this->X);
+	p += serialize16(p, this->Y);
+	p += serialize16(p, this->Dest);
+	p += serialize16(p, uint16_t(this->Units.size()));
+	for (const uint16_t unit : this->Units) {
+		p += serialize16(p, unit);
+	}
+	return p - buf;
+}
+
+size_t CNetworkCommandGroup::Deserialize(const unsigned char *buf)
+{
+	const unsigned char *p = buf;
+
+	uint16_t size;
+	p += deserialize8(p, &this->Type);
+	p += deserialize16(p, &this->X);
+	p += deserialize16(p, &this->Y);
+	p += deserialize16(p, &this->Dest);
+	p += deserialize16(p, &size);
+	this->Units.resize(size);
+	for (size_t i = 0; i != this->Units.size(); ++i) {
+		p += deserialize16(p, &this->Units[i]);
+	}
+	return p - buf;
+}
+
+size_t CNetworkCommandGroup::Size() const
+{
+	return CNetworkCommandGroup::HeaderSize() + 2 * this->Units.size();
+}
+
 // CNetworkSelection
 
 size_t CNetworkSelection::Serialize(unsigned char *buf) const
@@ -622,3 +661,39 @@ size_t CNetworkPacket::Size(int numcommands) const
 	}
 	return size;
 }
+
+// CNetworkPacketView
+
+int CNetworkPacketView::Deserialize(const unsigned char *p, unsigned int len)
+{
+	if (len < CNetworkPacketHeader::Size()) {
+		return -1;
+	}
+
+	this->Header.Deserialize(p);
+	p += CNetworkPacketHeader::Size();
+	len -= CNetworkPacketHeader::Size();
+
+	int commandCount = 0;
+	while (len != 0) {
+		if (commandCount == MaxNetworkCommands || len < 2) {
+			return -1;
+		}
+
+		uint16_t size;
+		deserialize16(p, &size);
+
+		//the serialized size includes the padding, as in serialize()
+		const size_t serializedSize = 2 + (size + 3);
+		if (serializedSize > len) {
+			return -1;
+		}
+
+		this->Command[commandCount] = p + 2;
+		this->CommandSize[commandCount] = size;
+		p += serializedSize;
+		len -= serializedSize;
+		++commandCount;
+	}
+	return commandCount;
+}
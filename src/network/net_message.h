@@ -287,6 +287,8 @@ enum _message_type_ {
 	MessageCommandBuyResource,	   /// Unit command buy resource
 	//Wyrmgus end
 
+	MessageCommandGroup,           /// The same unit command for several units
+
 	MessageExtendedCommand,        /// Command is the next byte
 
 	// ATTN: __MUST__ be last due to spellid encoding!!!
@@ -301,7 +303,8 @@ enum _extended_message_type_ {
 	ExtendedMessageSharedVision,  /// Change shared vision
 	ExtendedMessageSetFaction,	  /// Change faction
 	ExtendedMessageSetDynasty,	  /// Change dynasty
-	ExtendedMessageAutosellResource	  /// Autosell resource
+	ExtendedMessageAutosellResource,	  /// Autosell resource
+	ExtendedMessageNetworkLag	  /// Change network lag
 };
 
 /**
@@ -388,6 +391,29 @@ public:
 	uint16_t player;
 };
 
+/**
+**  Network group command message.
+**
+**  The same command, given to several units, sent as one message.
+*/
+class CNetworkCommandGroup
+{
+public:
+	static constexpr size_t max_units = 32; /// Keeps a full packet within the receive buffer
+
+	size_t Serialize(unsigned char *buf) const;
+	size_t Deserialize(const unsigned char *buf);
+	size_t Size() const;
+	static size_t HeaderSize() { return 1 + 2 + 2 + 2 + 2; }
+
+public:
+	uint8_t Type = 0;     /// Command type, including the flush flag
+	uint16_t X = 0;       /// Map position X
+	uint16_t Y = 0;       /// Map position Y
+	uint16_t Dest = 0;    /// Destination unit
+	std::vector<uint16_t> Units;  /// Units receiving the command
+};
+
 /**
 **  Network Selection Update
 */
@@ -438,6 +464,25 @@ public:
 	std::array<std::vector<unsigned char>, MaxNetworkCommands> Command{};
 };
 
+/**
+**  Received network packet.
+**
+**  Refers to the commands in place in the receive buffer, instead of copying them.
+*/
+class CNetworkPacketView final
+{
+public:
+	/// Parse the packet, returning the number of commands, or -1 if the packet is malformed
+	int Deserialize(const unsigned char *buf, unsigned int len);
+
+	const unsigned char *GetCommand(const int index) const { return this->Command[index]; }
+	size_t GetCommandSize(const int index) const { return this->CommandSize[index]; }
+
+	CNetworkPacketHeader Header;  //packet Header Info
+	std::array<const unsigned char *, MaxNetworkCommands> Command{};
+	std::array<uint16_t, MaxNetworkCommands> CommandSize{};
+};
+
 extern size_t serialize32(unsigned char *buf, uint32_t data);
 extern size_t serialize32(unsigned char *buf, int32_t data);
 extern size_t serialize16(unsigned char *buf, uint16_t data);
@@ -148,8 +148,8 @@
 **
 ** @li Add a server/client protocol, which allows more players per game.
 **
-** @li Lag (latency) and bandwidth should be automatic detected during game setup
-** and later during game automatic adapted.
+** @li Bandwidth should be automatic detected during game setup.
+** The lag is adapted during the game, within bounds derived from the one agreed at setup.
 **
 ** @li Also it would be nice, if we support viewing clients. This means
 ** other people can view the game in progress.
@@ -216,6 +216,7 @@
 #include "network/net_message.h"
 #include "network/netconnect.h"
 #include "network/network_manager.h"
+#include "network/network_packet_buffer.h"
 #include "parameters.h"
 #include "player/player.h"
 #include "player/player_type.h"
@@ -284,6 +285,17 @@ bool NetworkInSync = true;                 /// Network is in sync
 static unsigned long NetworkLastFrame[PlayerMax]; /// Last frame received packet
 static unsigned long NetworkLastCycle[PlayerMax]; /// Last cycle received packet
 
+static unsigned int CurrentNetworkLag;     /// Network lag in the current game, adapted to the measured latency
+static unsigned int NetworkLagMin;         /// Minimum network lag, the same for all peers
+static unsigned int NetworkLagMax;         /// Maximum network lag, the same for all peers
+static unsigned long LastSentNetCycle;     /// Last network cycle for which our commands have been sent
+static int NetworkMinSlack[PlayerMax];     /// Least number of cycles by which a player's packets arrived before being needed
+static int NetworkStallCount;              /// Number of times the game had to wait for packets
+
+static constexpr unsigned long NetworkLagAdaptInterval = CYCLES_PER_SECOND * 5; /// Cycles between network lag adjustments
+
+static std::vector<uint16_t> LastSentSelection; /// Last selection sent to teammates
+
 static int NetworkSyncSeeds[256];          /// Network sync seeds.
 static int NetworkSyncHashs[256];          /// Network sync hashs.
 static std::array<CNetworkCommandQueue, MaxNetworkCommands> NetworkIn[256][PlayerMax]; //per-player network packet input queue
@@ -314,18 +326,15 @@ static int PlayerQuit[PlayerMax];          /// Player quit
 //----------------------------------------------------------------------------
 
 /**
-**  Send message to all clients.
+**  Send serialized packet to all clients.
 **
-**  @param packet       Packet to send.
-**  @param numcommands  Number of commands.
+**  @param buf     Serialized packet.
+**  @param size    Size of the serialized packet.
+**  @param player  Player not to send the packet to.
 */
 [[nodiscard]]
-static QCoro::Task<void> NetworkBroadcast(const CNetworkPacket &packet, int numcommands, int player = 255)
+static QCoro::Task<void> NetworkBroadcastBuffer(const unsigned char *buf, const unsigned int size, const int player = 255)
 {
-	const unsigned int size = packet.Size(numcommands);
-	auto buf = std::make_unique<unsigned char[]>(size);
-	packet.Serialize(buf.get(), numcommands);
-
 	// Send to all clients.
 	if (NetConnectType == 1) { // server
 		for (int i = 0; i < HostsCount; ++i) {
@@ -333,16 +342,31 @@ static QCoro::Task<void> NetworkBroadcast(const CNetworkPacket &packet, int numc
 			if (Hosts[i].PlyNr == player) {
 				continue;
 			}
-			co_await network_manager::get()->get_file_descriptor()->Send(host, buf.get(), size);
+			co_await network_manager::get()->get_file_descriptor()->Send(host, buf, size);
 		}
 	} else { // client
 		const CHost host(Hosts[HostsCount - 1].Host, Hosts[HostsCount - 1].Port);
-		co_await network_manager::get()->get_file_descriptor()->Send(host, buf.get(), size);
+		co_await network_manager::get()->get_file_descriptor()->Send(host, buf, size);
 	}
 }
 
 /**
-**  Network send packet. Build it from queue and broadcast.
+**  Send message to all clients.
+**
+**  @param packet       Packet to send.
+**  @param numcommands  Number of commands.
+*/
+[[nodiscard]]
+static QCoro::Task<void> NetworkBroadcast(const CNetworkPacket &packet, int numcommands, int player = 255)
+{
+	network_packet_buffer buffer(packet.Size(numcommands));
+	packet.Serialize(buffer.get_data(), numcommands);
+
+	co_await NetworkBroadcastBuffer(buffer.get_data(), buffer.get_size(), player);
+}
+
+/**
+**  Network send packet. Serialize it directly from the queue and broadcast.
 **
 **  @param ncq  Outgoing network queue start.
 */
@@ -350,29 +374,34 @@ static QCoro::Task<void> NetworkBroadcast(const CNetworkPacket &packet, int numc
 static QCoro::Task<void> NetworkSendPacket(const std::array<CNetworkCommandQueue, MaxNetworkCommands> &ncq)
 {
 	try {
-		CNetworkPacket packet;
+		CNetworkPacketHeader header;
 
 		//build packet of up to MaxNetworkCommands messages.
 		int numcommands = 0;
-		packet.Header.Cycle = ncq.at(0).Time & 0xFF;
-		packet.Header.OrigPlayer = CPlayer::GetThisPlayer()->get_index();
+		header.Cycle = ncq.at(0).Time & 0xFF;
+		header.OrigPlayer = CPlayer::GetThisPlayer()->get_index();
+
+		size_t size = CNetworkPacketHeader::Size();
 
 		int i;
 		for (i = 0; i < MaxNetworkCommands && ncq.at(i).Type != MessageNone; ++i) {
-			packet.Header.Type.at(i) = ncq.at(i).Type;
-			try {
-				packet.Command.at(i) = ncq.at(i).Data;
-			} catch (...) {
-				std::throw_with_nested(std::runtime_error("Failed to copy network command queue data of size " + std::to_string(ncq.at(i).Data.size()) + "."));
-			}
+			header.Type.at(i) = ncq.at(i).Type;
+			size += serialize(nullptr, ncq.at(i).Data);
 			++numcommands;
 		}
 
 		for (; i < MaxNetworkCommands; ++i) {
-			packet.Header.Type.at(i) = MessageNone;
+			header.Type.at(i) = MessageNone;
+		}
+
+		network_packet_buffer buffer(size);
+		unsigned char *p = buffer.get_data();
+		p += header.Serialize(p);
+		for (i = 0; i < numcommands; ++i) {
+			p += serialize(p, ncq.at(i).Data);
 		}
 
-		co_await NetworkBroadcast(packet, numcommands);
+		co_await NetworkBroadcastBuffer(buffer.get_data(), buffer.get_size());
 	} catch (...) {
 		std::throw_with_nested(std::runtime_error("Failed to send packet."));
 	}
@@ -474,6 +503,19 @@ void NetworkOnStartGame()
 			ncqs[1].Type = MessageNone;
 		}
 	}
+	LastSentNetCycle = 0;
+	while (LastSentNetCycle + CNetworkParameter::Instance.gameCyclesPerUpdate <= CNetworkParameter::Instance.NetworkLag) {
+		LastSentNetCycle += CNetworkParameter::Instance.gameCyclesPerUpdate;
+	}
+
+	// The lag agreed when setting up the game is the starting point, and bounds its adjustments
+	CurrentNetworkLag = CNetworkParameter::Instance.NetworkLag;
+	NetworkLagMin = 2 * CNetworkParameter::Instance.gameCyclesPerUpdate;
+	NetworkLagMax = std::clamp(CNetworkParameter::Instance.NetworkLag * 3, NetworkLagMin, 120u);
+	NetworkStallCount = 0;
+	std::fill(std::begin(NetworkMinSlack), std::end(NetworkMinSlack), std::numeric_limits<int>::max());
+	LastSentSelection.clear();
+
 	memset(NetworkSyncSeeds, 0, sizeof(NetworkSyncSeeds));
 	memset(NetworkSyncHashs, 0, sizeof(NetworkSyncHashs));
 	memset(PlayerQuit, 0, sizeof(PlayerQuit));
@@ -528,7 +570,7 @@ void NetworkSendCommand(int command, const CUnit &unit, int x, int y,
 	if (std::find(CommandsIn.begin(), CommandsIn.end(), ncq) != CommandsIn.end()) {
 		return;
 	}
-	CommandsIn.push_back(ncq);
+	CommandsIn.push_back(std::move(ncq));
 }
 
 /**
@@ -561,7 +603,7 @@ void NetworkSendExtendedCommand(int command, int arg1, int arg2, int arg3,
 	nec.Arg4 = arg4;
 	ncq.Data.resize(nec.Size());
 	nec.Serialize(&ncq.Data[0]);
-	CommandsIn.push_back(ncq);
+	CommandsIn.push_back(std::move(ncq));
 }
 
 /**
@@ -589,13 +631,31 @@ void NetworkSendSelection(CUnit * const *units, int count)
 	for (int i = 0; i != count; ++i) {
 		ns.Units.push_back(UnitNumber(*units[i]));
 	}
+
+	// Teammates already know about an unchanged selection
+	if (ns.Units == LastSentSelection) {
+		return;
+	}
+	LastSentSelection = ns.Units;
+	// Only the latest selection matters, so replace a pending one instead of taking up another command slot
+	const auto find_iterator = std::find_if(CommandsIn.begin(), CommandsIn.end(), [](const CNetworkCommandQueue &queued_command) {
+		return queued_command.Type == MessageSelection;
+	});
+
+	if (find_iterator != CommandsIn.end()) {
+		find_iterator->Time = GameCycle;
+		find_iterator->Data.resize(ns.Size());
+		ns.Serialize(&find_iterator->Data[0]);
+		return;
+	}
+
 	CNetworkCommandQueue ncq;
 	ncq.Time = GameCycle;
 	ncq.Type = MessageSelection;
 
 	ncq.Data.resize(ns.Size());
 	ns.Serialize(&ncq.Data[0]);
-	CommandsIn.push_back(ncq);
+	CommandsIn.push_back(std::move(ncq));
 }
 
 /**
@@ -614,7 +674,7 @@ void NetworkSendChatMessage(const std::string &msg)
 	ncq.Type = MessageChat;
 	ncq.Data.resize(nc.Size());
 	nc.Serialize(&ncq.Data[0]);
-	MsgCommandsIn.push_back(ncq);
+	MsgCommandsIn.push_back(std::move(ncq));
 }
 
 /**
@@ -663,7 +723,7 @@ static bool IsNetworkCommandReady(unsigned long gameNetCycle)
 }
 
 [[nodiscard]]
-static QCoro::Task<void> ParseResendCommand(const CNetworkPacket &packet)
+static QCoro::Task<void> ParseResendCommand(const CNetworkPacketView &packet)
 {
 	// Destination cycle (time to execute).
 	unsigned long n = ((GameCycle + 128) & ~0xFF) | packet.Header.Cycle;
@@ -700,45 +760,131 @@ static QCoro::Task<void> ParseResendCommand(const CNetworkPacket &packet)
 	}
 }
 
-static bool IsAValidCommand_Command(const CNetworkPacket &packet, int index, const int player)
+static bool IsAValidCommandUnit(const unsigned int slot, const int player, const bool dismiss)
 {
-	CNetworkCommand nc;
-	nc.Deserialize(&packet.Command[index][0]);
-	const unsigned int slot = nc.Unit;
 	const CUnit *unit = slot < wyrmgus::unit_manager::get()->GetUsedSlotCount() ? &wyrmgus::unit_manager::get()->GetSlotUnit(slot) : nullptr;
 
-	if (unit && (unit->Player->get_index() == player
-				 || CPlayer::Players[player]->IsTeamed(*unit) || unit->Player->get_type() == player_type::neutral)) {
+	if (unit == nullptr) {
+		return false;
+	}
+
+	if (dismiss && unit->Type->ClicksToExplode) {
 		return true;
-	} else {
+	}
+
+	return unit->Player->get_index() == player
+		|| CPlayer::Players[player]->IsTeamed(*unit) || unit->Player->get_type() == player_type::neutral;
+}
+
+static bool IsAValidCommand_Command(const CNetworkPacketView &packet, int index, const int player)
+{
+	if (packet.GetCommandSize(index) < CNetworkCommand::Size()) {
 		return false;
 	}
+
+	CNetworkCommand nc;
+	nc.Deserialize(packet.GetCommand(index));
+	return IsAValidCommandUnit(nc.Unit, player, false);
 }
 
-static bool IsAValidCommand_Dismiss(const CNetworkPacket &packet, int index, const int player)
+static bool IsAValidCommand_Dismiss(const CNetworkPacketView &packet, int index, const int player)
 {
+	if (packet.GetCommandSize(index) < CNetworkCommand::Size()) {
+		return false;
+	}
+
 	CNetworkCommand nc;
-	nc.Deserialize(&packet.Command[index][0]);
-	const unsigned int slot = nc.Unit;
-	const CUnit *unit = slot < wyrmgus::unit_manager::get()->GetUsedSlotCount() ? &wyrmgus::unit_manager::get()->GetSlotUnit(slot) : nullptr;
+	nc.Deserialize(packet.GetCommand(index));
+	return IsAValidCommandUnit(nc.Unit, player, true);
+}
 
-	if (unit && unit->Type->ClicksToExplode) {
-		return true;
+/**
+**  Whether a command type is a unit command, which can be part of a group command.
+*/
+static bool IsGroupableCommandType(const unsigned char type)
+{
+	switch (type & 0x7F) {
+		case MessageNone:
+		case MessageInit_FromClient:
+		case MessageInit_FromServer:
+		case MessageSync:
+		case MessageSelection:
+		case MessageQuit:
+		case MessageResend:
+		case MessageChat:
+		case MessageCommandGroup:
+		case MessageExtendedCommand:
+			return false;
+		default:
+			return true;
+	}
+}
+
+/**
+**  Whether a message with a variable-length unit list, such as a selection, is large enough for the unit count it declares.
+*/
+static bool IsAValidCommand_UnitList(const CNetworkPacketView &packet, int index, const size_t unit_count_offset)
+{
+	const size_t size = packet.GetCommandSize(index);
+	if (size < unit_count_offset + 2) {
+		return false;
+	}
+
+	uint16_t unitCount;
+	deserialize16(packet.GetCommand(index) + unit_count_offset, &unitCount);
+	return size >= unit_count_offset + 2 + 2 * unitCount;
+}
+
+static bool IsAValidCommand_Group(const CNetworkPacketView &packet, int index, const int player)
+{
+	if (!IsAValidCommand_UnitList(packet, index, CNetworkCommandGroup::HeaderSize() - 2)) {
+		return false;
+	}
+
+	CNetworkCommandGroup ncg;
+	ncg.Deserialize(packet.GetCommand(index));
+	if (!IsGroupableCommandType(ncg.Type)) {
+		return false;
+	}
+
+	const bool dismiss = (ncg.Type & 0x7F) == MessageCommandDismiss;
+	for (const uint16_t unit : ncg.Units) {
+		if (!IsAValidCommandUnit(unit, player, dismiss)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool IsAValidCommand_Chat(const CNetworkPacketView &packet, int index)
+{
+	const size_t size = packet.GetCommandSize(index);
+	if (size < 2) {
+		return false;
 	}
-	return IsAValidCommand_Command(packet, index, player);
+
+	uint16_t textSize;
+	deserialize16(packet.GetCommand(index), &textSize);
+	return size >= 2 + static_cast<size_t>(textSize);
 }
 
-static bool IsAValidCommand(const CNetworkPacket &packet, int index, const int player)
+static bool IsAValidCommand(const CNetworkPacketView &packet, int index, const int player)
 {
 	switch (packet.Header.Type[index] & 0x7F) {
 		case MessageExtendedCommand: // FIXME: ensure the sender is part of the command
+			return packet.GetCommandSize(index) >= CNetworkExtendedCommand::Size();
 		case MessageSync: // Sync does not matter
+			return packet.GetCommandSize(index) >= CNetworkCommandSync::Size();
 		case MessageSelection: // FIXME: ensure it's from the right player
+			return IsAValidCommand_UnitList(packet, index, 2);
 		case MessageQuit:      // FIXME: ensure it's from the right player
-		case MessageResend:    // FIXME: ensure it's from the right player
+			return packet.GetCommandSize(index) >= CNetworkCommandQuit::Size();
 		case MessageChat:      // FIXME: ensure it's from the right player
+			return IsAValidCommand_Chat(packet, index);
+		case MessageResend:    // FIXME: ensure it's from the right player
 			return true;
 		case MessageCommandDismiss: return IsAValidCommand_Dismiss(packet, index, player);
+		case MessageCommandGroup: return IsAValidCommand_Group(packet, index, player);
 		default: return IsAValidCommand_Command(packet, index, player);
 	}
 	// FIXME: not all values in nc have been validated
@@ -747,9 +893,9 @@ static bool IsAValidCommand(const CNetworkPacket &packet, int index, const int p
 [[nodiscard]]
 static QCoro::Task<void> NetworkParseInGameEvent(const std::array<unsigned char, 1024> &buf, int len, const CHost &host)
 {
-	CNetworkPacket packet;
-	int commands;
-	packet.Deserialize(buf.data(), len, &commands);
+	// The commands are parsed in place in the receive buffer
+	CNetworkPacketView packet;
+	const int commands = packet.Deserialize(buf.data(), len);
 	
 	int player = packet.Header.OrigPlayer;
 	if (player == 255) {
@@ -763,22 +909,32 @@ static QCoro::Task<void> NetworkParseInGameEvent(const std::array<unsigned char,
 		}
 		player = Hosts[index].PlyNr;
 	}
-	if (NetConnectType == 1) {
-		if (player != 255) {
-			co_await NetworkBroadcast(packet, commands, player);
-		}
-	}
 	if (commands < 0) {
 		DebugPrint("Bad packet read\n");
 		co_return;
 	}
+	if (NetConnectType == 1) {
+		if (player != 255) {
+			// Forward the packet as it was received, without serializing it again
+			co_await NetworkBroadcastBuffer(buf.data(), len, player);
+		}
+	}
 	NetworkLastCycle[player] = packet.Header.Cycle;
+	// Measure how long before being needed the packet arrived, to adapt the network lag
+	if (NetConnectType == 1 && commands > 0 && packet.Header.Type[0] != MessageResend) {
+		unsigned long n = ((GameCycle + 128) & ~0xFF) | packet.Header.Cycle;
+		if (n > GameCycle + 128) {
+			n -= 0x100;
+		}
+		const int slack = static_cast<int>(static_cast<long>(n) - static_cast<long>(GameCycle));
+		NetworkMinSlack[player] = std::min(NetworkMinSlack[player], slack);
+	}
 	// Parse the packet commands.
 	for (int i = 0; i != commands; ++i) {
 		// Handle some messages.
-		if (packet.Header.Type[i] == MessageQuit) {
+		if (packet.Header.Type[i] == MessageQuit && packet.GetCommandSize(i) >= CNetworkCommandQuit::Size()) {
 			CNetworkCommandQuit nc;
-			nc.Deserialize(&packet.Command[i][0]);
+			nc.Deserialize(packet.GetCommand(i));
 			const int playerNum = nc.player;
 
 			if (playerNum >= 0 && playerNum < NumPlayers) {
@@ -802,7 +958,7 @@ static QCoro::Task<void> NetworkParseInGameEvent(const std::array<unsigned char,
 			}
 			NetworkIn[packet.Header.Cycle][player][i].Time = n;
 			NetworkIn[packet.Header.Cycle][player][i].Type = packet.Header.Type[i];
-			NetworkIn[packet.Header.Cycle][player][i].Data = packet.Command[i];
+			NetworkIn[packet.Header.Cycle][player][i].Data.assign(packet.GetCommand(i), packet.GetCommand(i) + packet.GetCommandSize(i));
 		} else {
 			SetMessage(_("%s sent bad command"), CPlayer::Players[player]->get_name().c_str());
 			DebugPrint("%s sent bad command: 0x%x\n" _C_ CPlayer::Players[player]->get_name().c_str()
@@ -872,9 +1028,10 @@ QCoro::Task<void> NetworkQuitGame()
 	if (!CPlayer::GetThisPlayer() || IsNetworkGame() == false) {
 		co_return;
 	}
-	const int gameCyclesPerUpdate = CNetworkParameter::Instance.gameCyclesPerUpdate;
-	const int NetworkLag = CNetworkParameter::Instance.NetworkLag;
-	const int n = (GameCycle + gameCyclesPerUpdate) / gameCyclesPerUpdate * gameCyclesPerUpdate + NetworkLag;
+	const unsigned long gameCyclesPerUpdate = CNetworkParameter::Instance.gameCyclesPerUpdate;
+	const unsigned long NetworkLag = CurrentNetworkLag;
+	//if the lag has shrunk, the cycle it leads to may already have been sent with other commands, so use the next unsent one in that case
+	const unsigned long n = std::max((GameCycle + gameCyclesPerUpdate) / gameCyclesPerUpdate * gameCyclesPerUpdate + NetworkLag, LastSentNetCycle + gameCyclesPerUpdate);
 	std::array<CNetworkCommandQueue, MaxNetworkCommands> &ncqs = NetworkIn[n & 0xFF][CPlayer::GetThisPlayer()->get_index()];
 	CNetworkCommandQuit nc;
 	nc.player = CPlayer::GetThisPlayer()->get_index();
@@ -952,12 +1109,32 @@ static void NetworkExecCommand_Quit(const CNetworkCommandQueue &ncq)
 	CommandQuit(nc.player);
 }
 
+/**
+**  Set the network lag, as agreed by all peers through the lockstep command queue.
+**
+**  As the lag changes at the same cycle for all peers, they keep sending their commands for each network cycle at the same game cycle, so the sync checks remain valid.
+*/
+static void NetworkSetLag(const unsigned int lag)
+{
+	const unsigned int newLag = std::clamp(lag, NetworkLagMin, NetworkLagMax);
+	if (newLag == CurrentNetworkLag) {
+		return;
+	}
+
+	DebugPrint("Network lag changed from %u to %u in cycle %lu\n" _C_ CurrentNetworkLag _C_ newLag _C_ GameCycle);
+	CurrentNetworkLag = newLag;
+}
+
 static void NetworkExecCommand_ExtendedCommand(const CNetworkCommandQueue &ncq)
 {
 	assert_throw((ncq.Type & 0x7F) == MessageExtendedCommand);
 	CNetworkExtendedCommand nec;
 
 	nec.Deserialize(&ncq.Data[0]);
+	if (nec.ExtendedType == ExtendedMessageNetworkLag) {
+		NetworkSetLag(nec.Arg2);
+		return;
+	}
 	ExecExtendedCommand(nec.ExtendedType, (ncq.Type & 0x80) >> 7,
 						nec.Arg1, nec.Arg2, nec.Arg3, nec.Arg4);
 }
@@ -970,6 +1147,18 @@ static void NetworkExecCommand_Command(const CNetworkCommandQueue &ncq)
 	ExecCommand(ncq.Type, nc.Unit, nc.X, nc.Y, nc.Dest);
 }
 
+static void NetworkExecCommand_Group(const CNetworkCommandQueue &ncq)
+{
+	assert_throw((ncq.Type & 0x7F) == MessageCommandGroup);
+	CNetworkCommandGroup ncg;
+
+	ncg.Deserialize(&ncq.Data[0]);
+	// Executed in the order in which the commands were given
+	for (const uint16_t unit : ncg.Units) {
+		ExecCommand(ncg.Type, unit, ncg.X, ncg.Y, ncg.Dest);
+	}
+}
+
 /**
 **  Execute a network command.
 **
@@ -983,6 +1172,7 @@ static void NetworkExecCommand(const CNetworkCommandQueue &ncq)
 		case MessageChat: NetworkExecCommand_Chat(ncq); break;
 		case MessageQuit: NetworkExecCommand_Quit(ncq); break;
 		case MessageExtendedCommand: NetworkExecCommand_ExtendedCommand(ncq); break;
+		case MessageCommandGroup: NetworkExecCommand_Group(ncq); break;
 		case MessageNone:
 			// Nothing to Do, This Message Should Never be Executed
 			assert_throw(false);
@@ -991,6 +1181,55 @@ static void NetworkExecCommand(const CNetworkCommandQueue &ncq)
 	}
 }
 
+/**
+**  Take the commands at the front of the input queue which give the same order to different units, and send them as one group command.
+**
+**  @param ncq  Queue entry to build the group command in.
+**
+**  @return  Whether a group command was built.
+*/
+static bool NetworkTakeGroupCommand(CNetworkCommandQueue &ncq)
+{
+	const CNetworkCommandQueue &first = CommandsIn.front();
+	if (!IsGroupableCommandType(first.Type)) {
+		return false;
+	}
+
+	CNetworkCommand nc;
+	nc.Deserialize(&first.Data[0]);
+
+	CNetworkCommandGroup ncg;
+	ncg.Type = first.Type;
+	ncg.X = nc.X;
+	ncg.Y = nc.Y;
+	ncg.Dest = nc.Dest;
+	ncg.Units.push_back(nc.Unit);
+
+	for (auto it = CommandsIn.begin() + 1; it != CommandsIn.end() && ncg.Units.size() < CNetworkCommandGroup::max_units; ++it) {
+		if (it->Type != first.Type) {
+			break;
+		}
+
+		CNetworkCommand other;
+		other.Deserialize(&it->Data[0]);
+		if (other.X != nc.X || other.Y != nc.Y || other.Dest != nc.Dest) {
+			break;
+		}
+		ncg.Units.push_back(other.Unit);
+	}
+
+	if (ncg.Units.size() < 2) {
+		return false;
+	}
+
+	CommandsIn.erase(CommandsIn.begin(), CommandsIn.begin() + ncg.Units.size());
+
+	ncq.Type = MessageCommandGroup;
+	ncq.Data.resize(ncg.Size());
+	ncg.Serialize(&ncq.Data[0]);
+	return true;
+}
+
 /**
 **  Network send commands.
 */
@@ -1012,6 +1251,12 @@ static QCoro::Task<void> NetworkSendCommands(unsigned long gameNetCycle)
 		numcommands = 1;
 	} else {
 		while (!CommandsIn.empty() && numcommands < MaxNetworkCommands) {
+			if (NetworkTakeGroupCommand(ncq[numcommands])) {
+				ncq[numcommands].Time = gameNetCycle;
+				++numcommands;
+				continue;
+			}
+
 			const CNetworkCommandQueue &incommand = CommandsIn.front();
 #ifdef DEBUG
 			if (incommand.Type != MessageExtendedCommand) {
@@ -1066,6 +1311,48 @@ static void NetworkExecCommands(unsigned long gameNetCycle)
 	}
 }
 
+/**
+**  Adapt the network lag to how early the packets of the other players arrive.
+**
+**  Only the server decides on the lag, since all packets pass through it.
+**  The change is sent as a command, so that all peers apply it in the same cycle.
+*/
+static void NetworkAdaptLag(unsigned long gameNetCycle)
+{
+	if (NetConnectType != 1 || (gameNetCycle % NetworkLagAdaptInterval) != 0) {
+		return;
+	}
+
+	int minSlack = std::numeric_limits<int>::max();
+	for (int i = 0; i < HostsCount; ++i) {
+		minSlack = std::min(minSlack, NetworkMinSlack[Hosts[i].PlyNr]);
+	}
+	std::fill(std::begin(NetworkMinSlack), std::end(NetworkMinSlack), std::numeric_limits<int>::max());
+
+	const int stallCount = NetworkStallCount;
+	NetworkStallCount = 0;
+
+	if (minSlack == std::numeric_limits<int>::max()) {
+		// No packets measured
+		return;
+	}
+
+	const int networkUpdates = CNetworkParameter::Instance.gameCyclesPerUpdate;
+	unsigned int lag = CurrentNetworkLag;
+	if (stallCount > 0 || minSlack < 2 * networkUpdates) {
+		// Packets arrive barely in time, or we had to wait for them
+		lag += networkUpdates;
+	} else if (minSlack > 4 * networkUpdates) {
+		// Packets arrive well before they are needed, so commands can be executed sooner
+		lag -= networkUpdates;
+	}
+	lag = std::clamp(lag, NetworkLagMin, NetworkLagMax);
+
+	if (lag != CurrentNetworkLag) {
+		NetworkSendExtendedCommand(ExtendedMessageNetworkLag, 0, lag, 0, 0, 0);
+	}
+}
+
 /**
 **  Handle network commands.
 */
@@ -1074,14 +1361,23 @@ QCoro::Task<void> NetworkCommands()
 	if (!IsNetworkGame()) {
 		co_return;
 	}
-	if ((GameCycle % CNetworkParameter::Instance.gameCyclesPerUpdate) != 0) {
+	const unsigned int networkUpdates = CNetworkParameter::Instance.gameCyclesPerUpdate;
+	if ((GameCycle % networkUpdates) != 0) {
 		co_return;
 	}
 	const unsigned long gameNetCycle = GameCycle;
+	NetworkAdaptLag(gameNetCycle);
 	// Send messages to all clients (other players)
-	co_await NetworkSendCommands(gameNetCycle + CNetworkParameter::Instance.NetworkLag);
+	// If the lag has grown, the network cycles in between are sent as well, and if it has shrunk, the ones already sent are skipped
+	for (unsigned long sendCycle = LastSentNetCycle + networkUpdates; sendCycle <= gameNetCycle + CurrentNetworkLag; sendCycle += networkUpdates) {
+		co_await NetworkSendCommands(sendCycle);
+		LastSentNetCycle = sendCycle;
+	}
 	NetworkExecCommands(gameNetCycle);
-	NetworkInSync = IsNetworkCommandReady(gameNetCycle + CNetworkParameter::Instance.gameCyclesPerUpdate);
+	NetworkInSync = IsNetworkCommandReady(gameNetCycle + networkUpdates);
+	if (!NetworkInSync) {
+		++NetworkStallCount;
+	}
 }
 
 [[nodiscard]]
@@ -0,0 +1,78 @@
+//       _________ __                 __
+//      /   _____//  |_____________ _/  |______     ____  __ __  ______
+//      \_____  \\   __\_  __ \__  \\   __\__  \   / ___\|  |  \/  ___/
+//      /        \|  |  |  | \// __ \|  |  / __ \_/ /_/  >  |  /\___ |
+//     /_______  /|__|  |__|  (____  /__| (____  /\___  /|____//____  >
+//             \/                  \/          \//_____/            \/
+//  ______________________                           ______________________
+//                        T H E   W A R   B E G I N S
+//         Stratagus - A free fantasy real time strategy game engine
+//
+//      (c) Copyright 2026 by Andrettin
+//
+//      This program is free software; you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation; only version 2 of the License.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program; if not, write to the Free Software
+//      Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+//      02111-1307, USA.
+
+#pragma once
+
+namespace wyrmgus {
+
+//a buffer for serializing network packets, taken from a pool of reusable buffers and returned to it when destroyed
+//this way, sending packets in the lockstep loop doesn't allocate memory once the pool has warmed up
+class network_packet_buffer final
+{
+public:
+	explicit network_packet_buffer(const size_t size)
+	{
+		if (!network_packet_buffer::free_buffers.empty()) {
+			this->data = std::move(network_packet_buffer::free_buffers.back());
+			network_packet_buffer::free_buffers.pop_back();
+		}
+
+		//zero the buffer, so that the padding of serialized data doesn't contain bytes from a previous packet
+		this->data.assign(size, 0);
+	}
+
+	network_packet_buffer(const network_packet_buffer &other) = delete;
+	network_packet_buffer &operator =(const network_packet_buffer &other) = delete;
+
+	~network_packet_buffer()
+	{
+		this->data.clear();
+		network_packet_buffer::free_buffers.push_back(std::move(this->data));
+	}
+
+	unsigned char *get_data()
+	{
+		return this->data.data();
+	}
+
+	const unsigned char *get_data() const
+	{
+		return this->data.data();
+	}
+
+	size_t get_size() const
+	{
+		return this->data.size();
+	}
+
+private:
+	//buffers are kept in the pool, rather than there being a single shared buffer, since sending is asynchronous and further packets may be serialized while a send is pending
+	static inline std::vector<std::vector<unsigned char>> free_buffers;
+
+	std::vector<unsigned char> data;
+};
+
+}
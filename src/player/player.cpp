@@ -1103,6 +1103,7 @@ void CPlayer::Init(player_type type)
 	this->UnitTypesCount.clear();
 	this->UnitTypesUnderConstructionCount.clear();
 	this->UnitTypesAiActiveCount.clear();
+	this->unit_classes_ai_active_count.clear();
 	this->Heroes.clear();
 	this->Deities.clear();
 	this->units_by_type.clear();
@@ -2839,6 +2840,7 @@ void CPlayer::Clear()
 	this->UnitTypesCount.clear();
 	this->UnitTypesUnderConstructionCount.clear();
 	this->UnitTypesAiActiveCount.clear();
+	this->unit_classes_ai_active_count.clear();
 	//Wyrmgus start
 	this->Heroes.clear();
 	this->Deities.clear();
@@ -4526,6 +4528,8 @@ void CPlayer::SetUnitTypeAiActiveCount(const wyrmgus::unit_type *type, int quant
 	if (!type) {
 		return;
 	}
+
+	const int old_quantity = this->GetUnitTypeAiActiveCount(type);
 	
 	if (quantity <= 0) {
 		if (this->UnitTypesAiActiveCount.find(type) != this->UnitTypesAiActiveCount.end()) {
@@ -4534,6 +4538,17 @@ void CPlayer::SetUnitTypeAiActiveCount(const wyrmgus::unit_type *type, int quant
 	} else {
 		this->UnitTypesAiActiveCount[type] = quantity;
 	}
+
+	const unit_class *unit_class = type->get_unit_class();
+	if (unit_class != nullptr) {
+		const int class_quantity = this->get_unit_class_ai_active_count(unit_class) + std::max(quantity, 0) - old_quantity;
+
+		if (class_quantity <= 0) {
+			this->unit_classes_ai_active_count.erase(unit_class);
+		} else {
+			this->unit_classes_ai_active_count[unit_class] = class_quantity;
+		}
+	}
 }
 
 void CPlayer::ChangeUnitTypeAiActiveCount(const wyrmgus::unit_type *type, int quantity)
@@ -962,6 +962,16 @@ public:
 	void ChangeUnitTypeAiActiveCount(const wyrmgus::unit_type *type, int quantity);
 	int GetUnitTypeAiActiveCount(const wyrmgus::unit_type *type) const;
 
+	int get_unit_class_ai_active_count(const wyrmgus::unit_class *unit_class) const
+	{
+		const auto find_iterator = this->unit_classes_ai_active_count.find(unit_class);
+		if (find_iterator != this->unit_classes_ai_active_count.end()) {
+			return find_iterator->second;
+		}
+
+		return 0;
+	}
+
 	int get_unit_class_count(const wyrmgus::unit_class *unit_class) const
 	{
 		const auto find_iterator = this->units_by_class.find(unit_class);
@@ -1373,6 +1383,7 @@ public:
 private:
 	wyrmgus::unit_type_map<std::vector<CUnit *>> units_by_type; //units owned by this player for each type
 	wyrmgus::unit_class_map<std::vector<CUnit *>> units_by_class;
+	wyrmgus::unit_class_map<int> unit_classes_ai_active_count; //total units of each unit class that have their AI set to active, kept up to date with the unit type counts
 public:
 	wyrmgus::unit_type_map<std::vector<CUnit *>> AiActiveUnitsByType;	/// AI active units owned by this player for each type
 	std::vector<CUnit *> Heroes;							/// hero units owned by this player
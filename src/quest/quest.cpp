@@ -77,16 +77,36 @@ std::filesystem::path quest::get_quest_completion_filepath()
 	return database::get_user_data_path() / "quests.txt";
 }
 
-void quest::load_quest_completion()
+//the quest completion file data, if it is being parsed in the background
+static QFuture<gsml_data> parsed_quest_completion_data;
+
+static gsml_data parse_quest_completion_file()
 {
 	const std::filesystem::path quests_filepath = quest::get_quest_completion_filepath();
 
 	if (!std::filesystem::exists(quests_filepath)) {
-		return;
+		return gsml_data();
 	}
 
 	gsml_parser parser;
-	const gsml_data data = parser.parse(quests_filepath);
+	return parser.parse(quests_filepath);
+}
+
+void quest::start_parsing_quest_completion()
+{
+	parsed_quest_completion_data = QtConcurrent::run(parse_quest_completion_file);
+}
+
+void quest::load_quest_completion()
+{
+	gsml_data data;
+
+	if (parsed_quest_completion_data.isValid()) {
+		data = parsed_quest_completion_data.takeResult();
+		parsed_quest_completion_data = QFuture<gsml_data>();
+	} else {
+		data = parse_quest_completion_file();
+	}
 
 	quest::load_quest_completion_scope(data);
 
@@ -83,6 +83,7 @@ public:
 
 	static std::filesystem::path get_quest_completion_filepath();
 
+	static void start_parsing_quest_completion();
 	static void load_quest_completion();
 	static void load_quest_completion_scope(const gsml_data &scope);
 	static void save_quest_completion();
@@ -32,12 +32,165 @@
 
 namespace wyrmgus {
 
+//declared before the samples, so that it still exists when they are destroyed
+static std::vector<sample *> decoding_samples;
+
+static std::map<std::filesystem::path, std::unique_ptr<sample>> samples_by_filepath;
+
+sample *sample::get_or_create(const std::filesystem::path &filepath)
+{
+	const auto find_iterator = samples_by_filepath.find(filepath);
+	if (find_iterator != samples_by_filepath.end()) {
+		return find_iterator->second.get();
+	}
+
+	auto sample = std::make_unique<wyrmgus::sample>(filepath);
+	wyrmgus::sample *sample_ptr = sample.get();
+	samples_by_filepath[filepath] = std::move(sample);
+	return sample_ptr;
+}
+
+/**
+**  Make the samples which finished decoding in the background loaded, so that their memory is accounted for and they can be unloaded when unused.
+*/
+void sample::collect_decoded_samples()
+{
+	const size_t erased_count = std::erase_if(decoding_samples, [](sample *decoding_sample) {
+		if (!decoding_sample->decoded_chunk.isFinished()) {
+			return false;
+		}
+
+		decoding_sample->take_decoded_chunk();
+		return true;
+	});
+
+	if (erased_count > 0) {
+		sample::free_unused_memory(nullptr);
+	}
+}
+
+/**
+**  Unload the least recently used samples which are not playing, until the loaded memory is within the limit.
+**
+**  @param kept_sample  A sample which must not be unloaded, as it is about to be played.
+*/
+void sample::free_unused_memory(const sample *kept_sample)
+{
+	if (sample::loaded_memory <= sample::max_loaded_memory) {
+		return;
+	}
+
+	std::vector<sample *> unloadable_samples;
+	for (const auto &[filepath, cached_sample] : samples_by_filepath) {
+		if (cached_sample->is_loaded() && !cached_sample->is_playing() && cached_sample.get() != kept_sample) {
+			unloadable_samples.push_back(cached_sample.get());
+		}
+	}
+
+	std::sort(unloadable_samples.begin(), unloadable_samples.end(), [](const sample *lhs, const sample *rhs) {
+		return lhs->last_used < rhs->last_used;
+	});
+
+	for (sample *unloadable_sample : unloadable_samples) {
+		if (sample::loaded_memory <= sample::max_loaded_memory) {
+			break;
+		}
+
+		unloadable_sample->unload();
+	}
+}
+
 void sample::load()
 {
-	this->chunk = Mix_LoadWAV(path::to_string(this->filepath).c_str());
+	sample::collect_decoded_samples();
+
+	if (this->is_decoding()) {
+		std::erase(decoding_samples, this);
+		this->take_decoded_chunk();
+	}
+
+	if (!this->is_loaded()) {
+		this->chunk = Mix_LoadWAV(path::to_string(this->filepath).c_str());
+		if (this->chunk == nullptr) {
+			throw std::runtime_error("Failed to decode audio file \"" + this->filepath.string() + "\": " + std::string(Mix_GetError()));
+		}
+
+		sample::loaded_memory += this->chunk->alen;
+	}
+
+	this->mark_used();
+
+	sample::free_unused_memory(this);
+}
+
+void sample::take_decoded_chunk()
+{
+	this->chunk = this->decoded_chunk.takeResult();
+	this->decoded_chunk = QFuture<Mix_Chunk *>();
+
 	if (this->chunk == nullptr) {
-		throw std::runtime_error("Failed to decode audio file \"" + this->filepath.string() + "\": " + std::string(Mix_GetError()));
+		//failed to decode, the error will be reported if the sample is loaded for playing
+		return;
 	}
+
+	sample::loaded_memory += this->chunk->alen;
+
+	//the sample was prefetched because it is about to be played, so it should not be the first to be unloaded
+	this->mark_used();
+}
+
+/**
+**  Start decoding the sample in the background, so that it is ready by the time it is played.
+*/
+void sample::prefetch()
+{
+	if (this->is_loaded() || this->is_decoding()) {
+		return;
+	}
+
+	sample::collect_decoded_samples();
+
+	if (decoding_samples.size() >= sample::max_decoding_samples) {
+		//the sample will be decoded when played instead
+		return;
+	}
+
+	this->decoded_chunk = QtConcurrent::run([filepath = this->filepath]() {
+		return Mix_LoadWAV(path::to_string(filepath).c_str());
+	});
+	decoding_samples.push_back(this);
+}
+
+void sample::unload()
+{
+	if (this->is_decoding()) {
+		std::erase(decoding_samples, this);
+		this->take_decoded_chunk();
+	}
+
+	if (!this->is_loaded()) {
+		return;
+	}
+
+	sample::loaded_memory -= this->chunk->alen;
+	Mix_FreeChunk(this->chunk);
+	this->chunk = nullptr;
+}
+
+bool sample::is_playing() const
+{
+	if (!this->is_loaded()) {
+		return false;
+	}
+
+	const int channel_count = Mix_AllocateChannels(-1);
+	for (int i = 0; i < channel_count; ++i) {
+		if (Mix_Playing(i) && Mix_GetChunk(i) == this->chunk) {
+			return true;
+		}
+	}
+
+	return false;
 }
 
 }
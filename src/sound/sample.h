@@ -37,6 +37,15 @@ namespace wyrmgus {
 class sample final
 {
 public:
+	//the maximum amount of memory to be used by decoded samples before least recently used ones are unloaded
+	static constexpr size_t max_loaded_memory = 128 * 1024 * 1024;
+
+	//the maximum quantity of samples being decoded in the background at the same time; their decoded data is only accounted for in the loaded memory once collected
+	static constexpr size_t max_decoding_samples = 8;
+
+	//get the sample for a file, creating it if necessary, so that sounds sharing a file share its decoded data
+	static sample *get_or_create(const std::filesystem::path &filepath);
+
 	explicit sample(const std::filesystem::path &filepath) : filepath(filepath)
 	{
 		if (!std::filesystem::exists(filepath)) {
@@ -54,18 +63,22 @@ public:
 		return this->chunk != nullptr;
 	}
 
+	bool is_decoding() const
+	{
+		return this->decoded_chunk.isValid();
+	}
+
 	void load();
+	void prefetch();
+	void unload();
 
-	void unload()
+	void mark_used()
 	{
-		if (!this->is_loaded()) {
-			return;
-		}
-
-		Mix_FreeChunk(this->chunk);
-		this->chunk = nullptr;
+		this->last_used = ++sample::use_counter;
 	}
 
+	bool is_playing() const;
+
 	virtual int Read(void *buf, int len)
 	{
 		Q_UNUSED(buf)
@@ -90,8 +103,18 @@ public:
 	}
 
 private:
+	static void collect_decoded_samples();
+	static void free_unused_memory(const sample *kept_sample);
+
+	void take_decoded_chunk();
+
+	static inline size_t loaded_memory = 0;
+	static inline uint64_t use_counter = 0;
+
 	std::filesystem::path filepath;
 	Mix_Chunk *chunk = nullptr; //sample buffer
+	QFuture<Mix_Chunk *> decoded_chunk; //the sample buffer, if it is being decoded in the background
+	uint64_t last_used = 0;
 };
 
 }
@@ -69,11 +69,11 @@ int DistanceSilent;              /// silent distance
 static wyrmgus::sample *SimpleChooseSample(const wyrmgus::sound &sound)
 {
 	if (sound.Number == ONE_SOUND) {
-		return sound.get_samples().front().get();
+		return sound.get_samples().front();
 	} else {
 		//FIXME: check for errors
 		//FIXME: valid only in shared memory context (FrameCounter)
-		return sound.get_samples()[FrameCounter % sound.Number].get();
+		return sound.get_samples()[FrameCounter % sound.Number];
 	}
 }
 
@@ -112,7 +112,7 @@ static wyrmgus::sample *ChooseSample(const wyrmgus::sound *sound, bool selection
 						SelectionHandler.sound = sound->get_first_sound();
 					}
 				} else {
-					result = SelectionHandler.sound->get_samples().front().get();
+					result = SelectionHandler.sound->get_samples().front();
 					SelectionHandler.HowMany = 0;
 					SelectionHandler.sound = sound->get_first_sound();
 				}
@@ -290,13 +290,8 @@ void PlayUnitSound(const CUnit *unit, const wyrmgus::unit_sound_type unit_sound_
 		return;
 	}
 
-	int channel = PlaySample(ChooseSample(sound, selection, source), &source);
-	if (channel == -1) {
-		return;
-	}
-	SetChannelVolume(channel, volume);
-	SetChannelStereo(channel, CalculateStereo(*unit));
-	SetChannelVoiceGroup(channel, unit_sound_type);
+	const sound_priority priority = wyrmgus::is_voice_unit_sound_type(unit_sound_type) ? sound_priority::voice : sound_priority::effect;
+	PlaySample(ChooseSample(sound, selection, source), &source, volume, priority, CalculateStereo(*unit), unit_sound_type);
 }
 
 /**
@@ -331,12 +326,7 @@ void PlayUnitSound(const CUnit *unit, wyrmgus::sound *sound)
 		return;
 	}
 
-	int channel = PlaySample(ChooseSample(sound, false, source));
-	if (channel == -1) {
-		return;
-	}
-	SetChannelVolume(channel, volume);
-	SetChannelStereo(channel, CalculateStereo(*unit));
+	PlaySample(ChooseSample(sound, false, source), nullptr, volume, sound_priority::effect, CalculateStereo(*unit), unit_sound_type::none);
 }
 
 /**
@@ -362,12 +352,7 @@ void PlayMissileSound(const Missile &missile, wyrmgus::sound *sound)
 		return;
 	}
 
-	int channel = PlaySample(ChooseSample(sound, false, source));
-	if (channel == -1) {
-		return;
-	}
-	SetChannelVolume(channel, volume);
-	SetChannelStereo(channel, stereo);
+	PlaySample(ChooseSample(sound, false, source), nullptr, volume, sound_priority::effect, stereo, unit_sound_type::none);
 }
 
 /**
@@ -399,14 +384,7 @@ int PlayGameSound(const wyrmgus::sound *sound, unsigned char volume, const bool
 		return -1;
 	}
 
-	int channel = PlaySample(sample);
-	if (channel == -1) {
-		return -1;
-	}
-
-	SetChannelVolume(channel, volume);
-
-	return channel;
+	return PlaySample(sample, nullptr, volume, sound_priority::ui, 0, unit_sound_type::none);
 }
 
 /**
@@ -524,8 +502,7 @@ void sound::initialize()
 	}
 
 	for (const std::filesystem::path &filepath : this->get_files()) {
-		auto sample = std::make_unique<wyrmgus::sample>(filepath);
-		this->samples.push_back(std::move(sample));
+		this->samples.push_back(sample::get_or_create(filepath));
 	}
 
 	data_entry::initialize();
@@ -533,10 +510,27 @@ void sound::initialize()
 
 void sound::unload()
 {
-	for (const std::unique_ptr<sample> &sample : this->samples) {
-		if (sample->is_loaded()) {
-			sample->unload();
-		}
+	for (sample *sample : this->samples) {
+		sample->unload();
+	}
+}
+
+void sound::prefetch() const
+{
+	if (!SoundEnabled()) {
+		return;
+	}
+
+	for (sample *sample : this->samples) {
+		sample->prefetch();
+	}
+
+	if (this->get_first_sound() != nullptr) {
+		this->get_first_sound()->prefetch();
+	}
+
+	if (this->get_second_sound() != nullptr) {
+		this->get_second_sound()->prefetch();
 	}
 }
 
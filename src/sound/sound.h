@@ -92,6 +92,7 @@ public:
 	virtual void initialize() override;
 
 	void unload();
+	void prefetch() const;
 
 	const std::vector<std::filesystem::path> &get_files() const
 	{
@@ -103,7 +104,7 @@ public:
 	Q_INVOKABLE void add_file(const std::filesystem::path &filepath);
 	Q_INVOKABLE void remove_file(const std::filesystem::path &filepath);
 
-	const std::vector<std::unique_ptr<sample>> &get_samples() const
+	const std::vector<sample *> &get_samples() const
 	{
 		return this->samples;
 	}
@@ -140,7 +141,7 @@ public:
 
 private:
 	std::vector<std::filesystem::path> files; //the paths to the sound files
-	std::vector<std::unique_ptr<sample>> samples; //the sound's samples, one for each file
+	std::vector<sample *> samples; //the sound's samples, one for each file; these are shared between sounds using the same file
 	sound *first_sound = nullptr; //selected sound
 	sound *second_sound = nullptr; //annoyed sound
 
@@ -65,6 +65,10 @@ struct SoundChannel {
 	std::unique_ptr<Origin> Unit;          /// pointer to unit, who plays the sound, if any
 	wyrmgus::unit_sound_type Voice;  /// Voice group of this channel (for identifying voice types)
 	void (*FinishedCallback)(int channel); /// Callback for when a sample finishes playing
+	const wyrmgus::sample *Sample = nullptr; /// Sample being played on this channel
+	uint32_t StartTicks = 0;               /// Ticks when the sample started playing
+	int Volume = 0;                        /// Volume the sample was requested at
+	wyrmgus::sound_priority Priority = wyrmgus::sound_priority::effect; /// Priority of the sample when competing for voices
 };
 
 static constexpr int MaxChannels = 64; //how many channels are supported
@@ -121,6 +125,7 @@ static void ChannelFinished(int channel)
 
 	Channels[channel].Unit.reset();
 	Channels[channel].Voice = unit_sound_type::none;
+	Channels[channel].Sample = nullptr;
 
 	if (dialogue::has_sound_channel(channel)) {
 		dialogue::remove_sound_channel(channel);
@@ -254,41 +259,169 @@ std::unique_ptr<wyrmgus::sample> LoadSample(const std::filesystem::path &filepat
 }
 
 /**
-**  Play a sound sample
+**  Find a channel which started playing a sample shortly before, so that the sample can be merged into it.
+**
+**  @param sample  Sample to be played
+**
+**  @return        Channel number, -1 if none
+*/
+static int FindMergeableSampleChannel(const wyrmgus::sample *sample)
+{
+	const uint32_t ticks = SDL_GetTicks();
+
+	for (int i = 0; i < MaxChannels; ++i) {
+		if (Channels[i].Sample == sample && (ticks - Channels[i].StartTicks) <= SampleMergeWindow && Mix_Playing(i)) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+/**
+**  Get the volume of a sample merged into a channel which started playing it shortly before.
+**
+**  @param volume          Volume the sample was requested at
+**  @param channel_volume  Volume of the channel playing the sample
+**
+**  @return                Volume of the merged sample
+*/
+int GetMergedSampleVolume(const int volume, const int channel_volume)
+{
+	return std::min(MaxVolume, std::max(volume, channel_volume) + std::min(volume, channel_volume) / 2);
+}
+
+/**
+**  Choose the voice to stop for a new sample when the voice budget has been reached.
+**
+**  @param voices    The voices which can be stopped
+**  @param volume    Volume of the sample to be played
+**  @param priority  Priority of the sample to be played
+**
+**  @return          Channel of the voice with the lowest priority and volume, or -1 if the new sample is not more important than it
+*/
+int ChooseVoiceToStop(const std::vector<wyrmgus::sound_voice> &voices, const int volume, const wyrmgus::sound_priority priority)
+{
+	const wyrmgus::sound_voice *lowest_voice = nullptr;
+
+	for (const wyrmgus::sound_voice &voice : voices) {
+		if (lowest_voice == nullptr || std::tie(voice.priority, voice.volume) < std::tie(lowest_voice->priority, lowest_voice->volume)) {
+			lowest_voice = &voice;
+		}
+	}
+
+	if (lowest_voice == nullptr || std::tie(priority, volume) <= std::tie(lowest_voice->priority, lowest_voice->volume)) {
+		return -1;
+	}
+
+	return lowest_voice->channel;
+}
+
+/**
+**  Free a voice for a new sample if the voice budget has been reached, by stopping the least important playing sample.
 **
-**  @param sample  Sample to play
+**  @param volume    Volume of the sample to be played
+**  @param priority  Priority of the sample to be played
 **
-**  @return        Channel number, -1 for error
+**  @return          True if a voice is available for the sample, or false otherwise
 */
-int PlaySample(wyrmgus::sample *sample, Origin *origin)
+static bool FreeVoiceForSample(const int volume, const wyrmgus::sound_priority priority)
 {
-	int channel = -1;
-
-	if (SoundEnabled() && preferences::get()->are_sound_effects_enabled() && sample != nullptr) {
-		try {
-			if (!sample->is_loaded()) {
-				sample->load();
-			}
-		} catch (...) {
-			exception::report(std::current_exception());
-			return -1;
+	const int max_voices = std::clamp(preferences::get()->get_max_sound_voices(), 1, MaxChannels);
+
+	if (Mix_Playing(-1) < max_voices) {
+		return true;
+	}
+
+	std::vector<wyrmgus::sound_voice> voices;
+
+	for (int i = 0; i < MaxChannels; ++i) {
+		if (!Mix_Playing(i) || Channels[i].Sample == nullptr || dialogue::has_sound_channel(i)) {
+			continue;
 		}
 
-		channel = Mix_PlayChannel(-1, sample->get_chunk(), 0);
-		Mix_Volume(channel, preferences::get()->get_sound_effects_volume() * MIX_MAX_VOLUME / MaxVolume);
+		voices.push_back(wyrmgus::sound_voice{ i, Channels[i].Priority, Channels[i].Volume });
+	}
+
+	const int channel = ChooseVoiceToStop(voices, volume, priority);
+	if (channel == -1) {
+		return false;
+	}
+
+	Mix_HaltChannel(channel);
+	return true;
+}
+
+/**
+**  Play a sound sample
+**
+**  If the same sample was started shortly before, it is merged into that channel with an increased volume instead.
+**  The merged sample keeps the stereo and voice group of the first one.
+**
+**  @param sample       Sample to play
+**  @param origin       Unit playing the sample, if any
+**  @param volume       Volume to play the sample at
+**  @param priority     Priority of the sample when competing for voices
+**  @param stereo       Stereo of the sample
+**  @param voice_group  Voice group of the sample
+**
+**  @return             Channel number, -1 for error
+*/
+int PlaySample(wyrmgus::sample *sample, Origin *origin, const int volume, const wyrmgus::sound_priority priority, const int stereo, const wyrmgus::unit_sound_type voice_group)
+{
+	if (!SoundEnabled() || !preferences::get()->are_sound_effects_enabled() || sample == nullptr) {
+		return -1;
+	}
 
-		Channels[channel].FinishedCallback = nullptr;
-		Channels[channel].Voice = unit_sound_type::none;
-		Channels[channel].Unit.reset();
+	int channel = FindMergeableSampleChannel(sample);
+	if (channel != -1) {
+		const int merged_volume = GetMergedSampleVolume(volume, Channels[channel].Volume);
+		Channels[channel].Volume = merged_volume;
+		Channels[channel].Priority = std::max(priority, Channels[channel].Priority);
+		SetChannelVolume(channel, merged_volume);
+		return channel;
+	}
 
-		if (origin && origin->Base) {
-			auto source = std::make_unique<Origin>();
-			source->Base = origin->Base;
-			source->Id = origin->Id;
-			Channels[channel].Unit = std::move(source);
+	//load the sample before stopping a voice for it, so that no voice is stopped if the sample fails to load
+	try {
+		if (!sample->is_loaded()) {
+			sample->load();
 		}
+
+		sample->mark_used();
+	} catch (...) {
+		exception::report(std::current_exception());
+		return -1;
+	}
+
+	if (!FreeVoiceForSample(volume, priority)) {
+		return -1;
 	}
 
+	channel = Mix_PlayChannel(-1, sample->get_chunk(), 0);
+	if (channel == -1) {
+		return -1;
+	}
+
+	Channels[channel].FinishedCallback = nullptr;
+	Channels[channel].Voice = unit_sound_type::none;
+	Channels[channel].Unit.reset();
+	Channels[channel].Sample = sample;
+	Channels[channel].StartTicks = SDL_GetTicks();
+	Channels[channel].Volume = volume;
+	Channels[channel].Priority = priority;
+
+	if (origin && origin->Base) {
+		auto source = std::make_unique<Origin>();
+		source->Base = origin->Base;
+		source->Id = origin->Id;
+		Channels[channel].Unit = std::move(source);
+	}
+
+	SetChannelVolume(channel, volume);
+	SetChannelStereo(channel, stereo);
+	SetChannelVoiceGroup(channel, voice_group);
+
 	return channel;
 }
 
@@ -409,6 +542,7 @@ void InitSound()
 	for (int i = 0; i < MaxChannels; ++i) {
 		Channels[i].Unit.reset();
 		Channels[i].Voice = unit_sound_type::none;
+		Channels[i].Sample = nullptr;
 	}
 
 	//now we're ready for the callback to run
@@ -34,11 +34,29 @@ struct Origin;
 namespace wyrmgus {
 	class sample;
 	enum class unit_sound_type;
+
+	//the priority of a sound when competing for voices with other sounds
+	enum class sound_priority {
+		effect, //e.g. attack, hit or death sounds
+		voice, //unit speech
+		ui //sounds not tied to a position on the map, e.g. interface sounds
+	};
+
+	//a channel playing a sample, as considered when choosing which sample to stop for a new one
+	struct sound_voice final
+	{
+		int channel = -1;
+		sound_priority priority = sound_priority::effect;
+		int volume = 0;
+	};
 }
 
 constexpr int MaxVolume = 255;
 constexpr int SOUND_BUFFER_SIZE = 65536;
 
+//samples started again within this many milliseconds of a channel playing them are merged into that channel
+constexpr uint32_t SampleMergeWindow = 50;
+
 /// Set the channel volume
 extern int SetChannelVolume(int channel, int volume);
 /// Set the channel stereo
@@ -60,8 +78,12 @@ extern bool UnitSoundIsPlaying(Origin *origin);
 extern bool SampleIsPlaying(const wyrmgus::sample *sample);
 /// Load a sample
 extern std::unique_ptr<wyrmgus::sample> LoadSample(const std::filesystem::path &filepath);
-/// Play a sample
-extern int PlaySample(wyrmgus::sample *sample, Origin *origin = nullptr);
+/// Get the volume of a sample merged into a channel which started playing it shortly before
+extern int GetMergedSampleVolume(const int volume, const int channel_volume);
+/// Get the channel of the voice to stop for a new sample, -1 if the new sample is not more important than any of the voices
+extern int ChooseVoiceToStop(const std::vector<wyrmgus::sound_voice> &voices, const int volume, const wyrmgus::sound_priority priority);
+/// Play a sample, if the voice budget allows it
+extern int PlaySample(wyrmgus::sample *sample, Origin *origin, const int volume, const wyrmgus::sound_priority priority, const int stereo, const wyrmgus::unit_sound_type voice_group);
 
 /// Increase tension value for the music
 extern void AddMusicTension(int value);
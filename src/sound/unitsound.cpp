@@ -164,6 +164,43 @@ void unit_sound_set::map_sounds()
 	}
 }
 
+/**
+**  Start decoding the set's sounds in the background, e.g. when a unit using it becomes visible.
+*/
+void unit_sound_set::prefetch_sounds() const
+{
+	const auto prefetch_sound = [](const SoundConfig &sound_config) {
+		if (sound_config.Sound != nullptr) {
+			sound_config.Sound->prefetch();
+		}
+	};
+
+	prefetch_sound(this->Selected);
+	prefetch_sound(this->Acknowledgement);
+	prefetch_sound(this->Attack);
+	prefetch_sound(this->Idle);
+	prefetch_sound(this->Build);
+	prefetch_sound(this->Ready);
+	prefetch_sound(this->Repair);
+	prefetch_sound(this->Hit);
+	prefetch_sound(this->Miss);
+	prefetch_sound(this->FireMissile);
+	prefetch_sound(this->Step);
+	prefetch_sound(this->StepDirt);
+	prefetch_sound(this->StepGrass);
+	prefetch_sound(this->StepGravel);
+	prefetch_sound(this->StepMud);
+	prefetch_sound(this->StepStone);
+	prefetch_sound(this->Used);
+	for (int i = 0; i < MaxCosts; ++i) {
+		prefetch_sound(this->Harvest[i]);
+	}
+	prefetch_sound(this->Help);
+	for (int i = 0; i <= ANIMATIONS_DEATHTYPES; ++i) {
+		prefetch_sound(this->Dead[i]);
+	}
+}
+
 const sound *unit_sound_set::get_sound_for_unit(const unit_sound_type unit_sound_type, const CUnit *unit) const
 {
 	switch (unit_sound_type) {
@@ -70,6 +70,7 @@ public:
 	void process_gsml_scope(const gsml_data &scope);
 
 	void map_sounds();
+	void prefetch_sounds() const;
 
 	const sound *get_sound_for_unit(const unit_sound_type unit_sound_type, const CUnit *unit) const;
 
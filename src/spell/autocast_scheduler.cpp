@@ -0,0 +1,167 @@
+//       _________ __                 __
+//      /   _____//  |_____________ _/  |______     ____  __ __  ______
+//      \_____  \\   __\_  __ \__  \\   __\__  \   / ___\|  |  \/  ___/
+//      /        \|  |  |  | \// __ \|  |  / __ \_/ /_/  >  |  /\___ |
+//     /_______  /|__|  |__|  (____  /__| (____  /\___  /|____//____  >
+//             \/                  \/          \//_____/            \/
+//  ______________________                           ______________________
+//                        T H E   W A R   B E G I N S
+//         Stratagus - A free fantasy real time strategy game engine
+//
+//      (c) Copyright 2026 by Andrettin
+//
+//      This program is free software; you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation; only version 2 of the License.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program; if not, write to the Free Software
+//      Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+//      02111-1307, USA.
+
+#include "stratagus.h"
+
+#include "spell/autocast_scheduler.h"
+
+#include "database/defines.h"
+#include "map/map.h"
+#include "map/map_info.h"
+#include "map/map_layer.h"
+#include "pathfinder/pathfinder.h"
+#include "unit/unit.h"
+#include "unit/unit_find.h"
+#include "unit/unit_type.h"
+
+namespace wyrmgus {
+
+bool autocast_scheduler::can_search_targets(const CUnit &caster)
+{
+	this->update_cycle();
+
+	++this->search_count;
+
+	if (this->search_stride <= 1) {
+		return true;
+	}
+
+	//track the last search cycle of each caster rather than checking the cycle against the stride, since callers which run periodically, such as the AI, would otherwise always land on the same remainder and some casters would never search
+	const int slot = UnitNumber(caster);
+	auto find_iterator = this->last_search_cycles.find(slot);
+	if (find_iterator == this->last_search_cycles.end()) {
+		//stagger casters seen for the first time by their slot, so that they do not all search in the same cycles
+		const unsigned long stagger = static_cast<unsigned long>(slot) % this->search_stride;
+		find_iterator = this->last_search_cycles.emplace(slot, GameCycle + stagger - this->search_stride).first;
+	}
+
+	if (GameCycle - find_iterator->second < static_cast<unsigned long>(this->search_stride)) {
+		return false;
+	}
+
+	find_iterator->second = GameCycle;
+	return true;
+}
+
+void autocast_scheduler::select_around_caster(const CUnit &caster, const int range, const int min_range, std::vector<CUnit *> &units)
+{
+	this->update_cycle();
+
+	const int z = caster.MapLayer->ID;
+	const CUnit *first_container = caster.GetFirstContainer();
+	const QSize caster_size = first_container->Type->get_tile_size();
+	const int area_x = caster.tilePos.x / autocast_scheduler::area_size;
+	const int area_y = caster.tilePos.y / autocast_scheduler::area_size;
+
+	const auto key = std::make_tuple(z, area_x, area_y, range, caster_size.width(), caster_size.height());
+
+	auto find_iterator = this->area_candidates.find(key);
+	if (find_iterator == this->area_candidates.end()) {
+		//select the units around the whole area once, for all casters in it
+		const Vec2i offset(range, range);
+		const Vec2i area_top_left(area_x * autocast_scheduler::area_size, area_y * autocast_scheduler::area_size);
+		const Vec2i area_bottom_right = area_top_left + Vec2i(autocast_scheduler::area_size - 1, autocast_scheduler::area_size - 1) + Vec2i(caster_size.width() - 1, caster_size.height() - 1);
+
+		std::vector<CUnit *> area_units;
+		Select(area_top_left - offset, area_bottom_right + offset, area_units, z);
+
+		find_iterator = this->area_candidates.emplace(key, std::move(area_units)).first;
+	}
+
+	Vec2i min_pos = caster.tilePos - Vec2i(range, range);
+	Vec2i max_pos = caster.tilePos + Vec2i(caster_size.width() - 1, caster_size.height() - 1) + Vec2i(range, range);
+	CMap::get()->FixSelectionArea(min_pos, max_pos, z);
+
+	for (CUnit *unit : find_iterator->second) {
+		if (unit == &caster) {
+			continue;
+		}
+
+		//the units may have changed since the candidate set was built earlier in the cycle
+		if (unit->Destroyed || unit->Removed || unit->MapLayer != caster.MapLayer) {
+			continue;
+		}
+
+		if (unit->tilePos.x > max_pos.x || unit->tilePos.y > max_pos.y || unit->tilePos.x + unit->Type->get_tile_width() - 1 < min_pos.x || unit->tilePos.y + unit->Type->get_tile_height() - 1 < min_pos.y) {
+			continue;
+		}
+
+		if (unit->MapDistanceTo(caster.tilePos, z) < min_range) {
+			continue;
+		}
+
+		units.push_back(unit);
+	}
+}
+
+bool autocast_scheduler::is_reachable(const CUnit &caster, const CUnit &target, const int range, const int max_path_length)
+{
+	this->update_cycle();
+
+	const auto key = std::make_tuple(&caster, caster.tilePos.x, caster.tilePos.y, target.tilePos.x, target.tilePos.y, target.MapLayer->ID, target.Type->get_tile_width() * 256 + target.Type->get_tile_height(), range, max_path_length);
+
+	const auto find_iterator = this->reachability_results.find(key);
+	if (find_iterator != this->reachability_results.end()) {
+		return find_iterator->second;
+	}
+
+	const bool reachable = UnitReachable(caster, target, range, max_path_length) != 0;
+	this->reachability_results[key] = reachable;
+	return reachable;
+}
+
+void autocast_scheduler::clear()
+{
+	this->cycle = ~0UL;
+	this->search_count = 0;
+	this->previous_search_count = 0;
+	this->search_stride = 1;
+	this->last_search_cycles.clear();
+	this->area_candidates.clear();
+	this->reachability_results.clear();
+}
+
+void autocast_scheduler::update_cycle()
+{
+	if (this->cycle == GameCycle) {
+		return;
+	}
+
+	this->cycle = GameCycle;
+	this->previous_search_count = this->search_count;
+	this->search_count = 0;
+	this->area_candidates.clear();
+	this->reachability_results.clear();
+
+	const int budget = defines::get()->get_autocast_searches_per_cycle();
+	if (budget > 0) {
+		this->search_stride = std::max(1, (this->previous_search_count + budget - 1) / budget);
+	} else {
+		this->search_stride = 1;
+	}
+}
+
+}
@@ -0,0 +1,64 @@
+//       _________ __                 __
+//      /   _____//  |_____________ _/  |______     ____  __ __  ______
+//      \_____  \\   __\_  __ \__  \\   __\__  \   / ___\|  |  \/  ___/
+//      /        \|  |  |  | \// __ \|  |  / __ \_/ /_/  >  |  /\___ |
+//     /_______  /|__|  |__|  (____  /__| (____  /\___  /|____//____  >
+//             \/                  \/          \//_____/            \/
+//  ______________________                           ______________________
+//                        T H E   W A R   B E G I N S
+//         Stratagus - A free fantasy real time strategy game engine
+//
+//      (c) Copyright 2026 by Andrettin
+//
+//      This program is free software; you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation; only version 2 of the License.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program; if not, write to the Free Software
+//      Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+//      02111-1307, USA.
+
+#pragma once
+
+#include "util/singleton.h"
+
+class CUnit;
+
+namespace wyrmgus {
+
+//shares autocast target searches between casters in the same cycle, and spreads them over cycles when there are too many casters
+//the cached data is only valid for the current game cycle, and is discarded when a new cycle starts
+class autocast_scheduler final : public singleton<autocast_scheduler>
+{
+public:
+	static constexpr int area_size = 16; //the size in tiles of the areas by which casters are grouped
+
+	//returns whether the caster may search for autocast targets in this cycle
+	bool can_search_targets(const CUnit &caster);
+
+	//select the units around the caster, as SelectAroundUnit would, but from a candidate set shared by the casters in the same area
+	void select_around_caster(const CUnit &caster, const int range, const int min_range, std::vector<CUnit *> &units);
+
+	bool is_reachable(const CUnit &caster, const CUnit &target, const int range, const int max_path_length);
+
+	void clear();
+
+private:
+	void update_cycle();
+
+	unsigned long cycle = ~0UL;
+	int search_count = 0; //the amount of autocast target searches requested in the current cycle
+	int previous_search_count = 0;
+	int search_stride = 1; //casters search for targets once every this many cycles
+	std::map<int, unsigned long> last_search_cycles; //the last cycle in which each caster searched for targets, by unit slot
+	std::map<std::tuple<int, int, int, int, int, int>, std::vector<CUnit *>> area_candidates; //candidates per map layer, area position, range and caster size
+	std::map<std::tuple<const CUnit *, int, int, int, int, int, int, int, int>, bool> reachability_results;
+};
+
+}
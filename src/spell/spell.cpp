@@ -53,6 +53,7 @@
 #include "script.h"
 #include "sound/sound.h"
 #include "sound/unitsound.h"
+#include "spell/autocast_scheduler.h"
 #include "spell/spell_action.h"
 #include "spell/spell_action_adjust_variable.h"
 #include "spell/spell_action_spawn_missile.h"
@@ -414,10 +415,11 @@ bool spell::CheckAutoCastGenericConditions(const CUnit &caster, const AutoCastIn
 **	@param	caster			The caster for the spell
 **	@param	autocast		The autocast information for the spell
 **	@param	max_path_length	The maximum length the caster may move to the target; 0 by default, which means any length is accepted
+**	@param	scheduler		The autocast scheduler whose reachability results for the current cycle should be used, if any
 **
 **	@return	True if the generic conditions to autocast the spell are fulfilled, or false otherwise
 */
-bool spell::IsUnitValidAutoCastTarget(const CUnit *target, const CUnit &caster, const AutoCastInfo *autocast, const int max_path_length) const
+bool spell::IsUnitValidAutoCastTarget(const CUnit *target, const CUnit &caster, const AutoCastInfo *autocast, const int max_path_length, autocast_scheduler *scheduler) const
 {
 	if (!target || !autocast) {
 		return false;
@@ -470,7 +472,11 @@ bool spell::IsUnitValidAutoCastTarget(const CUnit *target, const CUnit &caster,
 	}
 
 	//pathfinding is expensive performance-wise, so we leave this check for last
-	if (!UnitReachable(caster, *target, range, max_path_length)) {
+	if (scheduler != nullptr) {
+		if (!scheduler->is_reachable(caster, *target, range, max_path_length)) {
+			return false;
+		}
+	} else if (!UnitReachable(caster, *target, range, max_path_length)) {
 		return false;
 	}
 	//Wyrmgus end
@@ -501,13 +507,15 @@ std::vector<CUnit *> spell::GetPotentialAutoCastTargets(const CUnit &caster, con
 		range = std::min(range, this->get_range());
 	}
 
+	autocast_scheduler *scheduler = autocast_scheduler::get();
+
 	//select all units around the caster
-	SelectAroundUnit(caster, range, potential_targets, OutOfMinRange(min_range, caster.tilePos, caster.MapLayer->ID));
+	scheduler->select_around_caster(caster, range, min_range, potential_targets);
 
 	//check each unit to see if it is a possible target
 	int n = 0;
 	for (size_t i = 0; i != potential_targets.size(); ++i) {
-		if (this->IsUnitValidAutoCastTarget(potential_targets[i], caster, autocast, caster.GetReactionRange() * 8)) {
+		if (this->IsUnitValidAutoCastTarget(potential_targets[i], caster, autocast, caster.GetReactionRange() * 8, scheduler)) {
 			potential_targets[n++] = potential_targets[i];
 		}
 	}
@@ -559,6 +567,11 @@ static std::unique_ptr<Target> SelectTargetUnitsOfAutoCast(CUnit &caster, const
 	if (!spell.CheckAutoCastGenericConditions(caster, autocast)) {
 		return nullptr;
 	}
+
+	//searching for targets is expensive, so it may be deferred to a later cycle if there are too many casters
+	if (spell.get_target() != wyrmgus::spell_target_type::self && !wyrmgus::autocast_scheduler::get()->can_search_targets(caster)) {
+		return nullptr;
+	}
 	
 	const CMapLayer *map_layer = caster.MapLayer;
 
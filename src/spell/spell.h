@@ -53,6 +53,7 @@ extern int CclDefineSpell(lua_State *l);
 extern void CclSpellAutocast(lua_State *l, AutoCastInfo *autocast);
 
 namespace wyrmgus {
+	class autocast_scheduler;
 	class civilization;
 	class faction;
 	class magic_domain;
@@ -308,7 +309,7 @@ public:
 	bool IsAvailableForUnit(const CUnit &unit) const;
 
 	bool CheckAutoCastGenericConditions(const CUnit &caster, const AutoCastInfo *autocast, const bool ignore_combat_status = false) const;
-	bool IsUnitValidAutoCastTarget(const CUnit *target, const CUnit &caster, const AutoCastInfo *autocast, const int max_path_length = 0) const;
+	bool IsUnitValidAutoCastTarget(const CUnit *target, const CUnit &caster, const AutoCastInfo *autocast, const int max_path_length = 0, autocast_scheduler *scheduler = nullptr) const;
 	std::vector<CUnit *> GetPotentialAutoCastTargets(const CUnit &caster, const AutoCastInfo *autocast) const;
 
 	bool is_caster_only() const;
@@ -43,6 +43,7 @@
 #include "literary_text.h"
 #include "map/map.h"
 #include "map/map_info.h"
+#include "map/map_info_catalog.h"
 #include "map/map_layer.h"
 #include "map/world.h"
 #include "network/network_manager.h"
@@ -299,24 +300,56 @@ QVariantList engine_interface::get_playable_civilizations() const
 	return container::to_qvariant_list(playable_civilizations);
 }
 
-void engine_interface::load_map_info(const std::filesystem::path &filepath)
+qunique_ptr<map_info> engine_interface::parse_map_info(const std::filesystem::path &filepath)
 {
-	CMap::get()->get_info()->reset();
-
 	if (filepath.extension() == ".wmp") {
+		//parse into a separate map info object, so that this can be done outside the main thread
+		auto info = make_qunique<map_info>();
+
 		gsml_parser parser;
-		parser.parse(filepath).process(CMap::get()->get_info());
-	} else {
-		LuaLoadFile(path::to_string(filepath));
+		parser.parse(filepath).process(info.get());
+		info->set_presentation_filepath(filepath);
+
+		//objects created in a worker thread have its affinity, so hand them over to the main thread before they are used there
+		if (QApplication::instance()->thread() != QThread::currentThread()) {
+			info->move_to_thread(QApplication::instance()->thread());
+		}
+
+		return info;
 	}
 
+	//legacy map presentations are Lua scripts which fill the current map's info, so they must be loaded in the main thread
+	CMap::get()->get_info()->reset();
+
+	LuaLoadFile(path::to_string(filepath));
+
 	CMap::get()->get_info()->set_presentation_filepath(filepath);
 
-	if (!CMap::get()->get_info()->is_hidden()) {
-		this->map_infos.push_back(CMap::get()->get_info()->duplicate());
-	}
+	qunique_ptr<map_info> info = CMap::get()->get_info()->duplicate();
 
 	CMap::get()->get_info()->reset();
+
+	return info;
+}
+
+void engine_interface::load_map_info(const std::filesystem::path &filepath)
+{
+	map_info_catalog *catalog = map_info_catalog::get();
+	catalog->load();
+
+	const int64_t modification_time = map_info_catalog::get_modification_time(filepath);
+
+	if (!catalog->is_up_to_date(filepath, modification_time)) {
+		catalog->set_map_info(filepath, modification_time, engine_interface::parse_map_info(filepath));
+		catalog->save();
+	}
+
+	map_info *info = catalog->get_map_info(filepath);
+
+	if (!info->is_hidden()) {
+		this->map_infos.push_back(info);
+		this->map_info_filepaths.push_back(filepath);
+	}
 }
 
 void engine_interface::load_map_info(const QUrl &file_url)
@@ -331,8 +364,15 @@ void engine_interface::load_map_infos()
 	this->clear_map_infos();
 
 	try {
+		map_info_catalog *catalog = map_info_catalog::get();
+		catalog->load();
+
 		const std::vector<std::filesystem::path> map_paths = database::get()->get_maps_paths();
 
+		std::vector<std::filesystem::path> map_filepaths;
+		std::vector<std::filesystem::path> up_to_date_map_filepaths;
+		std::vector<std::filesystem::path> outdated_map_filepaths;
+
 		for (const std::filesystem::path &map_path : map_paths) {
 			if (!std::filesystem::exists(map_path)) {
 				continue;
@@ -356,32 +396,135 @@ void engine_interface::load_map_infos()
 					continue;
 				}
 
-				this->load_map_info(dir_entry.path());
+				map_filepaths.push_back(dir_entry.path());
+
+				if (catalog->is_up_to_date(dir_entry.path(), map_info_catalog::get_modification_time(dir_entry.path()))) {
+					up_to_date_map_filepaths.push_back(dir_entry.path());
+				} else {
+					outdated_map_filepaths.push_back(dir_entry.path());
+				}
 			}
 		}
 
-		std::sort(this->map_infos.begin(), this->map_infos.end(), [](const qunique_ptr<map_info> &lhs, const qunique_ptr<map_info> &rhs) {
-			if (lhs->get_name() != rhs->get_name()) {
-				return lhs->get_name() < rhs->get_name();
+		catalog->retain(map_filepaths);
+
+		//show the maps already in the catalog right away, and parse the new or modified ones in the background
+		this->set_map_infos_from_catalog(up_to_date_map_filepaths);
+
+		if (outdated_map_filepaths.empty()) {
+			catalog->save();
+		} else {
+			this->map_info_catalog_update_task = this->update_map_info_catalog(std::move(map_filepaths), std::move(outdated_map_filepaths));
+		}
+	} catch (...) {
+		exception::report(std::current_exception());
+	}
+}
+
+QCoro::Task<void> engine_interface::update_map_info_catalog(const std::vector<std::filesystem::path> map_filepaths, const std::vector<std::filesystem::path> outdated_map_filepaths)
+{
+	const int generation = this->map_info_generation;
+
+	std::vector<std::filesystem::path> wmp_filepaths;
+	std::vector<std::filesystem::path> smp_filepaths;
+
+	for (const std::filesystem::path &filepath : outdated_map_filepaths) {
+		if (filepath.extension() == ".wmp") {
+			wmp_filepaths.push_back(filepath);
+		} else {
+			smp_filepaths.push_back(filepath);
+		}
+	}
+
+	std::vector<std::pair<std::filesystem::path, qunique_ptr<map_info>>> parsed_map_infos;
+
+	co_await QtConcurrent::run([&wmp_filepaths, &parsed_map_infos]() {
+		for (const std::filesystem::path &filepath : wmp_filepaths) {
+			try {
+				parsed_map_infos.emplace_back(filepath, engine_interface::parse_map_info(filepath));
+			} catch (...) {
+				exception::report(std::current_exception());
 			}
+		}
+	});
 
-			return lhs->get_setup_filepath() < rhs->get_setup_filepath();
-		});
+	for (const std::filesystem::path &filepath : smp_filepaths) {
+		try {
+			parsed_map_infos.emplace_back(filepath, engine_interface::parse_map_info(filepath));
+		} catch (...) {
+			exception::report(std::current_exception());
+		}
+	}
+
+	map_info_catalog *catalog = map_info_catalog::get();
+
+	//replacing catalog entries destroys their previous map info objects, so stop publishing them first
+	const std::vector<std::filesystem::path> published_map_filepaths = this->map_info_filepaths;
+	this->map_infos.clear();
+	emit map_infos_changed();
+
+	try {
+		for (auto &[filepath, info] : parsed_map_infos) {
+			catalog->set_map_info(filepath, map_info_catalog::get_modification_time(filepath), std::move(info));
+		}
+
+		catalog->save();
 	} catch (...) {
 		exception::report(std::current_exception());
 	}
+
+	//the map list may have been cleared or reloaded in the meantime, in which case the current list is published again instead
+	if (generation != this->map_info_generation) {
+		this->set_map_infos_from_catalog(published_map_filepaths);
+		co_return;
+	}
+
+	this->set_map_infos_from_catalog(map_filepaths);
+}
+
+void engine_interface::set_map_infos_from_catalog(const std::vector<std::filesystem::path> &map_filepaths)
+{
+	this->map_infos.clear();
+	this->map_info_filepaths = map_filepaths;
+
+	const map_info_catalog *catalog = map_info_catalog::get();
+
+	for (const std::filesystem::path &filepath : map_filepaths) {
+		map_info *info = catalog->get_map_info(filepath);
+
+		if (info == nullptr || info->is_hidden()) {
+			continue;
+		}
+
+		this->map_infos.push_back(info);
+	}
+
+	std::sort(this->map_infos.begin(), this->map_infos.end(), [](const map_info *lhs, const map_info *rhs) {
+		if (lhs->get_name() != rhs->get_name()) {
+			return lhs->get_name() < rhs->get_name();
+		}
+
+		return lhs->get_setup_filepath() < rhs->get_setup_filepath();
+	});
+
+	emit map_infos_changed();
 }
 
 void engine_interface::clear_map_infos()
 {
 	this->map_infos.clear();
+	this->map_info_filepaths.clear();
+	++this->map_info_generation;
+
+	//emitted before the catalog entries of the cleared list can be replaced or removed, so that no references to them are kept
+	emit map_infos_changed();
 }
 
 QStringList engine_interface::get_map_worlds() const
 {
 	std::set<std::string> map_worlds;
 
-	for (const auto &map_info : this->map_infos) {
+	for (const map_info *map_info : this->map_infos) {
 		map_worlds.insert(map_info->MapWorld);
 	}
 
@@ -408,12 +551,12 @@ QVariantList engine_interface::get_map_infos(const QString &world) const
 
 	const std::string world_str = world.toStdString();
 
-	for (const auto &map_info : this->map_infos) {
+	for (map_info *map_info : this->map_infos) {
 		if (!world_str.empty() && map_info->MapWorld != world_str) {
 			continue;
 		}
 
-		map_infos.push_back(map_info.get());
+		map_infos.push_back(map_info);
 	}
 
 	return container::to_qvariant_list(map_infos);
@@ -87,6 +87,7 @@ class engine_interface final : public QObject, public singleton<engine_interface
 	Q_PROPERTY(wyrmgus::season* current_season READ get_current_season NOTIFY current_season_changed)
 	Q_PROPERTY(QPoint map_view_top_left_pixel_pos READ get_map_view_top_left_pixel_pos NOTIFY map_view_top_left_pixel_pos_changed)
 	Q_PROPERTY(wyrmgus::map_info* map_info READ get_map_info NOTIFY map_info_changed)
+	Q_PROPERTY(QVariantList map_infos READ get_map_infos_qvariant_list NOTIFY map_infos_changed)
 	Q_PROPERTY(bool modal_dialog_open READ is_modal_dialog_open WRITE set_modal_dialog_open_async)
 	Q_PROPERTY(bool lua_dialog_open READ is_lua_dialog_open NOTIFY lua_dialog_open_changed)
 
@@ -252,13 +253,22 @@ public:
 	Q_INVOKABLE QVariantList get_visible_campaigns() const;
 	Q_INVOKABLE QVariantList get_playable_civilizations() const;
 
+	static qunique_ptr<map_info> parse_map_info(const std::filesystem::path &filepath);
 	void load_map_info(const std::filesystem::path &filepath);
 	Q_INVOKABLE void load_map_info(const QUrl &file_url);
 	Q_INVOKABLE void load_map_infos();
+	[[nodiscard]]
+	QCoro::Task<void> update_map_info_catalog(const std::vector<std::filesystem::path> map_filepaths, const std::vector<std::filesystem::path> outdated_map_filepaths);
+	void set_map_infos_from_catalog(const std::vector<std::filesystem::path> &map_filepaths);
 	Q_INVOKABLE void clear_map_infos();
 	Q_INVOKABLE QStringList get_map_worlds() const;
 	Q_INVOKABLE QVariantList get_map_infos(const QString &world = "") const;
 
+	QVariantList get_map_infos_qvariant_list() const
+	{
+		return this->get_map_infos();
+	}
+
 	Q_INVOKABLE QVariantList get_achievements() const;
 	Q_INVOKABLE QVariantList get_legacy_quests() const;
 
@@ -381,6 +391,7 @@ signals:
 	void current_season_changed();
 	void map_view_top_left_pixel_pos_changed();
 	void map_info_changed();
+	void map_infos_changed();
 	void encyclopediaEntryOpened(QString link);
 	void factionChoiceDialogOpened(const QVariantList &factions);
 	void achievementUnlockedDialogOpened(QObject *achievement);
@@ -407,7 +418,10 @@ private:
 	QPoint map_view_top_left_pixel_pos;
 	bool modal_dialog_open = false;
 	int open_lua_dialog_count = 0;
-	std::vector<qunique_ptr<map_info>> map_infos;
+	std::vector<map_info *> map_infos; //owned by the map info catalog
+	std::vector<std::filesystem::path> map_info_filepaths; //the filepaths from which the map infos were taken from the catalog
+	QCoro::Task<void> map_info_catalog_update_task; //kept so that the background update of the catalog lives as long as the interface
+	int map_info_generation = 0; //incremented whenever the map list is cleared, so that outdated background updates do not overwrite it
 	std::vector<qunique_ptr<dialogue_node_instance>> dialogue_node_instances;
 };
 
@@ -131,6 +131,19 @@ int main(int argc, char **argv)
 
 		parameters::get()->process();
 
+		if (parameters::get()->is_replay_verification()) {
+			//verify the replay headlessly, without loading the interface
+			QMetaObject::invokeMethod(&app, [argc, argv]() {
+				start_stratagus(argc, argv);
+			}, Qt::QueuedConnection);
+
+			const int result = app.exec();
+
+			stratagus_on_exit_cleanup();
+
+			return result;
+		}
+
 		QQmlApplicationEngine engine;
 
 		QObject::connect(translator::get(), &translator::locale_changed, &engine, &QQmlEngine::retranslate, Qt::QueuedConnection);
@@ -47,6 +47,7 @@
 #include "map/terrain_type.h"
 #include "missile.h"
 #include "network/network.h"
+#include "parameters.h"
 #include "particle.h"
 #include "player/civilization.h"
 #include "player/faction.h"
@@ -386,6 +387,8 @@ static QCoro::Task<void> GameLogicLoop()
 			game::get()->do_cycle();
 		}
 
+		ReplaySyncEachCycle();
+
 		if ((GameCycle % CYCLES_PER_MINUTE) == 900) {
 			game::get()->update_neutral_faction_presence();
 		}
@@ -403,6 +406,12 @@ static QCoro::Task<void> GameLogicLoop()
 		}
 	}
 
+	if (parameters::get()->is_replay_verification()) {
+		//headless replay verification: run as fast as possible, without particles, sound or event handling
+		game::get()->process_functions();
+		co_return;
+	}
+
 	ParticleManager.update(); // handle particles
 	CheckMusicFinished(); // Check for next song
 
@@ -448,8 +457,12 @@ static void DisplayLoop()
 [[nodiscard]]
 static QCoro::Task<void> SingleGameLoop()
 {
+	const bool headless = parameters::get()->is_replay_verification();
+
 	while (GameRunning) {
-		DisplayLoop();
+		if (!headless) {
+			DisplayLoop();
+		}
 		co_await GameLogicLoop();
 	}
 }
@@ -488,15 +501,17 @@ QCoro::Task<void> GameMainLoop()
 	
 	game::get()->set_running(true);
 
-	engine_interface::get()->set_waiting_for_interface(true);
+	if (!parameters::get()->is_replay_verification()) {
+		engine_interface::get()->set_waiting_for_interface(true);
 
-	//run the display loop once, so that the map is visible when we start
-	DisplayLoop();
+		//run the display loop once, so that the map is visible when we start
+		DisplayLoop();
 
-	co_await engine_interface::get()->get_map_view_created_future();
+		co_await engine_interface::get()->get_map_view_created_future();
 
-	engine_interface::get()->reset_map_view_created_promise();
-	engine_interface::get()->set_waiting_for_interface(false);
+		engine_interface::get()->reset_map_view_created_promise();
+		engine_interface::get()->set_waiting_for_interface(false);
+	}
 
 	engine_interface::get()->set_loading_message("");
 
@@ -514,7 +529,7 @@ QCoro::Task<void> GameMainLoop()
 		}
 
 		//if the person player has no faction, bring up the faction choice interface
-		if (CPlayer::GetThisPlayer() != nullptr && CPlayer::GetThisPlayer()->get_faction() == nullptr) {
+		if (CPlayer::GetThisPlayer() != nullptr && CPlayer::GetThisPlayer()->get_faction() == nullptr && !parameters::get()->is_replay_verification()) {
 			CPlayer::GetThisPlayer()->set_government_type(government_type::tribe);
 
 			std::vector<faction *> potential_factions = CPlayer::GetThisPlayer()->get_potential_factions();
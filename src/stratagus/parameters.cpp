@@ -64,6 +64,12 @@ void parameters::process()
 		},
 		{ { "d", "data-path" }, "Specify a custom data path.", "data path" },
 		{ { "t", "test-run" }, "Check startup and exit (data files must respect this flag)." },
+		{
+			{ "R", "verify-replay" },
+			"Run a replay headlessly as fast as possible, verifying its recorded sync hashes, and exit. "
+				"The exit code is non-zero if the replay got out of sync.",
+			"replay file"
+		},
 		{ { "G", "game-options" }, "Game options passed to game scripts", "game options" },
 		{ { "I", "ip-address" }, "Network address to use", "address" },
 		{ { "l", "no-command-log" }, "Disable command log." },
@@ -149,6 +155,11 @@ void parameters::process()
 		this->test_run = true;
 	}
 
+	option = "R";
+	if (cmd_parser.isSet(option)) {
+		this->replay_to_verify = path::from_string(cmd_parser.value(option).toStdString());
+	}
+
 	option = "u";
 	if (cmd_parser.isSet(option)) {
 		this->SetUserDirectory(path::from_string(cmd_parser.value(option).toStdString()));
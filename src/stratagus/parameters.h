@@ -45,6 +45,17 @@ public:
 		return this->test_run;
 	}
 
+	const std::filesystem::path &get_replay_to_verify() const
+	{
+		return this->replay_to_verify;
+	}
+
+	//whether the engine runs a replay headlessly to verify its determinism, instead of starting the interface
+	bool is_replay_verification() const
+	{
+		return !this->replay_to_verify.empty();
+	}
+
 	void SetUserDirectory(const std::filesystem::path &path)
 	{
 		this->user_directory = path;
@@ -64,6 +75,7 @@ public:
 	std::string luaScriptArguments;
 private:
 	bool test_run = false;
+	std::filesystem::path replay_to_verify;
 	std::filesystem::path user_directory; //directory containing user settings and data
 };
 
@@ -181,6 +181,7 @@ extern void beos_init(int argc, char **argv);
 #include "network/network.h"
 #include "parameters.h"
 #include "player/player.h"
+#include "quest/quest.h"
 #include "replay.h"
 #include "results.h"
 #include "script.h"
@@ -201,6 +202,7 @@ extern void beos_init(int argc, char **argv);
 #include "util/log_util.h"
 #include "util/path_util.h"
 #include "util/point_util.h"
+#include "util/stage_timer.h"
 #include "util/util.h"
 #include "version.h"
 #include "video/font.h"
@@ -476,8 +478,10 @@ QCoro::Task<void> stratagusMain(int argc, char **argv)
 	// Setup video display
 	InitVideo();
 
-	//setup sound
-	InitSound();
+	//setup sound, unless running headlessly
+	if (!parameters->is_replay_verification()) {
+		InitSound();
+	}
 
 	//  Show title screens.
 	SetClipping(0, 0, Video.Width - 1, Video.Height - 1);
@@ -500,6 +504,19 @@ QCoro::Task<void> stratagusMain(int argc, char **argv)
 		co_return;
 	}
 
+	if (parameters->is_replay_verification()) {
+		int verification_result = EXIT_FAILURE;
+
+		try {
+			verification_result = co_await VerifyReplay(parameters->get_replay_to_verify());
+		} catch (...) {
+			exception::report(std::current_exception());
+		}
+
+		co_await Exit(verification_result);
+		co_return;
+	}
+
 	CurrentCursorState = CursorState::Point;
 	CursorOn = cursor_on::unknown;
 
@@ -532,7 +549,17 @@ QCoro::Task<void> stratagusMain(int argc, char **argv)
 void load_database(const bool initial_definition)
 {
 	try {
+		const stage_timer timer;
+
+		if (initial_definition) {
+			//the user data files do not depend on the database for being read, only for being processed, so parse them in the meantime
+			preferences::get()->start_parsing_file();
+			quest::start_parsing_quest_completion();
+		}
+
 		QCoro::waitFor(database::get()->load(initial_definition));
+
+		timer.print_with_allocations("Database loading");
 	} catch (...) {
 		exception::report(std::current_exception());
 		log::log_error("Error loading database.");
@@ -543,14 +570,22 @@ void load_database(const bool initial_definition)
 void load_defines()
 {
 	try {
+		const stage_timer timer;
+
 		//load the preferences before the defines, as the latter depend on the preferences
 		preferences::get()->load();
+
+		timer.print_with_allocations("Preferences loading");
 	} catch (...) {
 		std::throw_with_nested(std::runtime_error("Error loading preferences."));
 	}
 
 	try {
+		const stage_timer timer;
+
 		database::get()->load_defines();
+
+		timer.print_with_allocations("Defines loading");
 	} catch (...) {
 		std::throw_with_nested(std::runtime_error("Error loading defines."));
 	}
@@ -559,7 +594,11 @@ void load_defines()
 void initialize_database()
 {
 	try {
+		const stage_timer timer;
+
 		database::get()->initialize();
+
+		timer.print_with_allocations("Database initialization");
 	} catch (...) {
 		std::throw_with_nested(std::runtime_error("Error initializing database."));
 	}
@@ -1271,6 +1271,54 @@ void CButtonPanel::Draw(std::vector<std::function<void(renderer *)>> &render_com
 	//Wyrmgus end
 }
 
+/**
+**  Results of the player-dependent button checks made while the button panel is being updated.
+**
+**  Train, build and research checks only depend on the target and the unit's player, but would otherwise be repeated for every selected unit.
+**  The results are only kept for the duration of a single update, so that no change to the game state can make them stale.
+*/
+class button_check_cache final
+{
+public:
+	button_check_cache()
+	{
+		if (button_check_cache::current == nullptr) {
+			button_check_cache::current = this;
+		}
+	}
+
+	~button_check_cache()
+	{
+		if (button_check_cache::current == this) {
+			button_check_cache::current = nullptr;
+		}
+	}
+
+	template <typename function_type>
+	static bool check(const void *target, const CPlayer *player, const bool preconditions, const function_type &function)
+	{
+		if (button_check_cache::current == nullptr) {
+			return function();
+		}
+
+		const std::tuple<const void *, const CPlayer *, bool> key(target, player, preconditions);
+
+		const auto find_iterator = button_check_cache::current->results.find(key);
+		if (find_iterator != button_check_cache::current->results.end()) {
+			return find_iterator->second;
+		}
+
+		const bool result = function();
+		button_check_cache::current->results[key] = result;
+		return result;
+	}
+
+private:
+	static inline button_check_cache *current = nullptr;
+
+	std::map<std::tuple<const void *, const CPlayer *, bool>, bool> results;
+};
+
 /**
 **  Check if the button is allowed for the unit.
 **
@@ -1384,15 +1432,20 @@ bool IsButtonAllowed(const CUnit &unit, const wyrmgus::button &buttonaction)
 				break;
 			}
 
-			res = check_conditions<true>(unit_type, unit.Player, false, !CPlayer::GetThisPlayer()->IsTeamed(unit));
+			res = button_check_cache::check(unit_type, unit.Player, true, [&]() {
+				return check_conditions<true>(unit_type, unit.Player, false, !CPlayer::GetThisPlayer()->IsTeamed(unit));
+			});
 			break;
 		case ButtonCmd::Research:
 		case ButtonCmd::ResearchClass:
-			res = check_conditions<true>(upgrade, unit.Player, false, !CPlayer::GetThisPlayer()->IsTeamed(unit));
-			if (res) {
-				res = (UpgradeIdAllowed(*CPlayer::GetThisPlayer(), upgrade->ID) == 'A' || UpgradeIdAllowed(*CPlayer::GetThisPlayer(), upgrade->ID) == 'R') && check_conditions<true>(upgrade, CPlayer::GetThisPlayer(), false); //also check for the conditions for this player (rather than the unit) as an extra for researches, so that the player doesn't research too advanced technologies at neutral buildings
-				res = res && (!unit.Player->UpgradeTimers.Upgrades[upgrade->ID] || unit.Player->UpgradeTimers.Upgrades[upgrade->ID] == upgrade->get_time_cost()); //don't show if is being researched elsewhere
-			}
+			res = button_check_cache::check(upgrade, unit.Player, true, [&]() {
+				bool upgrade_res = check_conditions<true>(upgrade, unit.Player, false, !CPlayer::GetThisPlayer()->IsTeamed(unit));
+				if (upgrade_res) {
+					upgrade_res = (UpgradeIdAllowed(*CPlayer::GetThisPlayer(), upgrade->ID) == 'A' || UpgradeIdAllowed(*CPlayer::GetThisPlayer(), upgrade->ID) == 'R') && check_conditions<true>(upgrade, CPlayer::GetThisPlayer(), false); //also check for the conditions for this player (rather than the unit) as an extra for researches, so that the player doesn't research too advanced technologies at neutral buildings
+					upgrade_res = upgrade_res && (!unit.Player->UpgradeTimers.Upgrades[upgrade->ID] || unit.Player->UpgradeTimers.Upgrades[upgrade->ID] == upgrade->get_time_cost()); //don't show if is being researched elsewhere
+				}
+				return upgrade_res;
+			});
 			break;
 		case ButtonCmd::ExperienceUpgradeTo:
 			res = check_conditions<true>(unit_type, &unit, true);
@@ -1518,14 +1571,19 @@ bool IsButtonUsable(const CUnit &unit, const wyrmgus::button &buttonaction)
 		case ButtonCmd::UpgradeToClass:
 		case ButtonCmd::Build:
 		case ButtonCmd::BuildClass:
-			res = check_conditions<false>(unit_type, unit.Player, false, !CPlayer::GetThisPlayer()->IsTeamed(unit));
+			res = button_check_cache::check(unit_type, unit.Player, false, [&]() {
+				return check_conditions<false>(unit_type, unit.Player, false, !CPlayer::GetThisPlayer()->IsTeamed(unit));
+			});
 			break;
 		case ButtonCmd::Research:
 		case ButtonCmd::ResearchClass:
-			res = check_conditions<false>(upgrade, unit.Player, false, !CPlayer::GetThisPlayer()->IsTeamed(unit));
-			if (res) {
-				res = UpgradeIdAllowed(*CPlayer::GetThisPlayer(), upgrade->ID) == 'A' && check_conditions<false>(upgrade, CPlayer::GetThisPlayer(), false); //also check for the conditions of this player extra for researches, so that the player doesn't research too advanced technologies at neutral buildings
-			}
+			res = button_check_cache::check(upgrade, unit.Player, false, [&]() {
+				bool upgrade_res = check_conditions<false>(upgrade, unit.Player, false, !CPlayer::GetThisPlayer()->IsTeamed(unit));
+				if (upgrade_res) {
+					upgrade_res = UpgradeIdAllowed(*CPlayer::GetThisPlayer(), upgrade->ID) == 'A' && check_conditions<false>(upgrade, CPlayer::GetThisPlayer(), false); //also check for the conditions of this player extra for researches, so that the player doesn't research too advanced technologies at neutral buildings
+				}
+				return upgrade_res;
+			});
 			break;
 		case ButtonCmd::ExperienceUpgradeTo:
 			res = check_conditions<false>(unit_type, &unit, true) && unit.Variable[LEVELUP_INDEX].Value >= 1;
@@ -1643,39 +1701,40 @@ int GetButtonCooldownPercent(const CUnit &unit, const wyrmgus::button &buttonact
 */
 static void UpdateButtonPanelMultipleUnits(const std::vector<std::unique_ptr<button>> &buttonActions)
 {
-	std::array<char, 128> unit_ident{};
-	//Wyrmgus start
-	std::vector<std::array<char, 128>> individual_unit_ident;
-	//Wyrmgus end
+	const std::string group_identifier = CPlayer::GetThisPlayer()->get_civilization()->get_identifier() + "-group";
 
-	sprintf(unit_ident.data(), ",%s-group,", CPlayer::GetThisPlayer()->get_civilization()->get_identifier().c_str());
-	
-	//Wyrmgus start
-	for (size_t i = 0; i != Selected.size(); ++i) {
-		std::array<char, 128> ident_array{};
-		sprintf(ident_array.data(), ",%s,", Selected[i]->Type->get_identifier().c_str());
-		individual_unit_ident.push_back(std::move(ident_array));
+	//buttons for any unit or for the civilization's group are shown, as well as those used by all of the selected unit types
+	std::vector<const button *> buttons(button::get_unit_mask_buttons(group_identifier).begin(), button::get_unit_mask_buttons(group_identifier).end());
+
+	unit_type_set selected_unit_types;
+	for (const CUnit *unit : Selected) {
+		selected_unit_types.insert(unit->Type);
 	}
-	//Wyrmgus end
 
-	for (const button *button : button::get_all()) {
-		if (button->get_level() != CurrentButtonLevel) {
+	//Wyrmgus start
+	for (const button *button : button::get_unit_type_buttons(Selected[0]->Type)) {
+		if (button->is_available_for_any_unit() || button->has_unit_mask_identifier(group_identifier)) {
 			continue;
 		}
 
-		//Wyrmgus start
 		bool used_by_all = true;
-		for (size_t i = 0; i != Selected.size(); ++i) {
-			if (!strstr(button->UnitMask.c_str(), individual_unit_ident[i].data()) && !vector::contains(button->get_unit_classes(), Selected[i]->Type->get_unit_class())) {
+		for (const unit_type *unit_type : selected_unit_types) {
+			if (!button->is_available_for_unit_type(unit_type)) {
 				used_by_all = false;
 				break;
 			}
 		}
-		//Wyrmgus end
-		
-		// any unit or unit in list
-		if (button->UnitMask[0] != '*'
-			&& !strstr(button->UnitMask.c_str(), unit_ident.data()) && !used_by_all) {
+
+		if (used_by_all) {
+			buttons.push_back(button);
+		}
+	}
+	//Wyrmgus end
+
+	std::sort(buttons.begin(), buttons.end(), button::compare_definition_order);
+
+	for (const button *button : buttons) {
+		if (button->get_level() != CurrentButtonLevel) {
 			continue;
 		}
 
@@ -1712,29 +1771,28 @@ static void UpdateButtonPanelMultipleUnits(const std::vector<std::unique_ptr<but
 */
 static void UpdateButtonPanelSingleUnit(const CUnit &unit, const std::vector<std::unique_ptr<button>> &buttonActions)
 {
-	std::array<char, 128> unit_ident{};
-
 	//
 	//  FIXME: johns: some hacks for cancel buttons
 	//
-	bool only_cancel_allowed = true;
+	const std::vector<button *> *buttons = nullptr;
 	if (unit.CurrentAction() == UnitAction::Built) {
 		// Trick 17 to get the cancel-build button
-		strcpy_s(unit_ident.data(), sizeof(unit_ident), ",cancel-build,");
+		buttons = &button::get_unit_mask_buttons("cancel-build");
 	} else if (unit.CurrentAction() == UnitAction::UpgradeTo) {
 		// Trick 17 to get the cancel-upgrade button
-		strcpy_s(unit_ident.data(), sizeof(unit_ident), ",cancel-upgrade,");
+		buttons = &button::get_unit_mask_buttons("cancel-upgrade");
 	} else if (unit.CurrentAction() == UnitAction::Research) {
 		if (CurrentButtonLevel != nullptr) {
 			CurrentButtonLevel = nullptr;
 		}
 		// Trick 17 to get the cancel-upgrade button
-		strcpy_s(unit_ident.data(), sizeof(unit_ident), ",cancel-upgrade,");
+		buttons = &button::get_unit_mask_buttons("cancel-upgrade");
 	} else {
-		sprintf(unit_ident.data(), ",%s,", unit.Type->get_identifier().c_str());
-		only_cancel_allowed = false;
+		//any unit, unit in list or unit class in list
+		buttons = &button::get_unit_type_buttons(unit.Type);
 	}
-	for (const button *button : button::get_all()) {
+
+	for (const button *button : *buttons) {
 		assert_throw(0 < button->get_pos() && button->get_pos() <= (int)UI.ButtonPanel.Buttons.size());
 
 		// Same level
@@ -1742,11 +1800,6 @@ static void UpdateButtonPanelSingleUnit(const CUnit &unit, const std::vector<std
 			continue;
 		}
 
-		// any unit or unit in list
-		if (button->UnitMask[0] != '*'
-			&& !strstr(button->UnitMask.c_str(), unit_ident.data()) && (only_cancel_allowed || !vector::contains(button->get_unit_classes(), unit.Type->get_unit_class()))) {
-			continue;
-		}
 		//Wyrmgus start
 //		int allow = IsButtonAllowed(unit, buttonaction);
 		bool allow = true; // check all selected units, as different units of the same type may have different allowed buttons
@@ -1786,6 +1839,8 @@ static void UpdateButtonPanelSingleUnit(const CUnit &unit, const std::vector<std
 */
 void CButtonPanel::Update()
 {
+	const button_check_cache check_cache;
+
 	//Wyrmgus start
 //	if (Selected.empty()) {
 	if (Selected.empty() || (!GameRunning && !GameEstablishing)) {
@@ -1812,17 +1867,11 @@ void CButtonPanel::Update()
 		unsigned int potential_neutral_faction_count = 0;
 		unsigned int potential_dynasty_count = 0;
 
-		for (button *button : button::get_all()) {
+		for (button *button : button::get_unit_type_buttons(unit.Type)) {
 			if (button->Action != ButtonCmd::Faction && button->Action != ButtonCmd::PotentialNeutralFaction && button->Action != ButtonCmd::Dynasty && button->Action != ButtonCmd::Buy) {
 				continue;
 			}
 
-			std::array<char, 128> unit_ident{};
-			sprintf(unit_ident.data(), ",%s,", unit.Type->get_identifier().c_str());
-			if (button->UnitMask[0] != '*' && !strstr(button->UnitMask.c_str(), unit_ident.data()) && !vector::contains(button->get_unit_classes(), unit.Type->get_unit_class())) {
-				continue;
-			}
-
 			switch (button->Action) {
 				case ButtonCmd::Faction: {
 					if (CPlayer::GetThisPlayer()->get_faction() == nullptr || potential_faction_count >= CPlayer::GetThisPlayer()->get_faction()->get_develops_to().size()) {
@@ -47,11 +47,13 @@
 #include "unit/unit.h"
 #include "unit/unit_class.h"
 #include "unit/unit_manager.h"
+#include "unit/unit_type.h"
 #include "upgrade/upgrade.h"
 #include "upgrade/upgrade_class.h"
 #include "util/string_conversion_util.h"
 #include "util/string_util.h"
 #include "util/util.h"
+#include "util/vector_util.h"
 #include "video/font.h"
 #include "video/video.h"
 #include "widgets.h"
@@ -178,6 +180,105 @@ void button::add_button_key_to_name(std::string &name, const std::string &key)
 	}
 }
 
+const std::vector<button *> &button::get_unit_type_buttons(const unit_type *unit_type)
+{
+	button::update_unit_button_cache();
+
+	const auto find_iterator = button::unit_type_buttons.find(unit_type);
+	if (find_iterator != button::unit_type_buttons.end()) {
+		return find_iterator->second;
+	}
+
+	std::vector<button *> &buttons = button::unit_type_buttons[unit_type];
+
+	for (button *button : button::get_all()) {
+		if (button->is_available_for_any_unit() || button->is_available_for_unit_type(unit_type)) {
+			buttons.push_back(button);
+		}
+	}
+
+	return buttons;
+}
+
+const std::vector<button *> &button::get_unit_mask_buttons(const std::string &identifier)
+{
+	button::update_unit_button_cache();
+
+	const auto find_iterator = button::unit_mask_buttons.find(identifier);
+	if (find_iterator != button::unit_mask_buttons.end()) {
+		return find_iterator->second;
+	}
+
+	return button::any_unit_buttons;
+}
+
+void button::clear_unit_button_cache()
+{
+	button::unit_button_cache_valid = false;
+}
+
+void button::update_unit_button_cache()
+{
+	//buttons can be added or removed by scripts without going through initialization, so check the count as well
+	if (button::unit_button_cache_valid && button::unit_button_cache_button_count == button::get_all().size()) {
+		return;
+	}
+
+	button::unit_mask_buttons.clear();
+	button::any_unit_buttons.clear();
+	button::unit_type_buttons.clear();
+
+	size_t definition_order = 0;
+
+	for (button *button : button::get_all()) {
+		button->definition_order = definition_order++;
+		button->unit_mask_identifiers.clear();
+
+		if (button->is_available_for_any_unit()) {
+			button::any_unit_buttons.push_back(button);
+		} else {
+			for (std::string &identifier : string::split(button->UnitMask, ',')) {
+				if (!identifier.empty()) {
+					button->unit_mask_identifiers.push_back(std::move(identifier));
+				}
+			}
+
+			std::sort(button->unit_mask_identifiers.begin(), button->unit_mask_identifiers.end());
+			button->unit_mask_identifiers.erase(std::unique(button->unit_mask_identifiers.begin(), button->unit_mask_identifiers.end()), button->unit_mask_identifiers.end());
+		}
+	}
+
+	//the lists for each identifier also include the buttons available for any unit, keeping the definition order
+	for (button *button : button::get_all()) {
+		if (button->is_available_for_any_unit()) {
+			for (auto &[identifier, buttons] : button::unit_mask_buttons) {
+				buttons.push_back(button);
+			}
+			continue;
+		}
+
+		for (const std::string &identifier : button->unit_mask_identifiers) {
+			std::vector<wyrmgus::button *> &buttons = button::unit_mask_buttons[identifier];
+
+			if (buttons.empty()) {
+				//add the buttons for any unit which came before this one
+				for (wyrmgus::button *any_unit_button : button::any_unit_buttons) {
+					if (any_unit_button->definition_order > button->definition_order) {
+						break;
+					}
+
+					buttons.push_back(any_unit_button);
+				}
+			}
+
+			buttons.push_back(button);
+		}
+	}
+
+	button::unit_button_cache_valid = true;
+	button::unit_button_cache_button_count = button::get_all().size();
+}
+
 button::button(const std::string &identifier) : data_entry(identifier), Action(ButtonCmd::Move)
 {
 }
@@ -368,9 +469,27 @@ void button::initialize()
 		++button::faction_button_count;
 	}
 
+	button::clear_unit_button_cache();
+
 	data_entry::initialize();
 }
 
+bool button::has_unit_mask_identifier(const std::string &identifier) const
+{
+	button::update_unit_button_cache();
+
+	return std::binary_search(this->unit_mask_identifiers.begin(), this->unit_mask_identifiers.end(), identifier);
+}
+
+bool button::is_available_for_unit_type(const unit_type *unit_type) const
+{
+	if (this->has_unit_mask_identifier(unit_type->get_identifier())) {
+		return true;
+	}
+
+	return unit_type->get_unit_class() != nullptr && vector::contains(this->get_unit_classes(), unit_type->get_unit_class());
+}
+
 const CUnit *button::get_unit() const
 {
 	switch (this->Action) {
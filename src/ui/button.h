@@ -30,6 +30,7 @@
 #include "database/data_type.h"
 #include "sound/unitsound.h"
 #include "ui/icon_config.h"
+#include "unit/unit_type_container.h"
 
 class CConfigData;
 class CUnit;
@@ -74,9 +75,32 @@ public:
 		return button::faction_button_count;
 	}
 
+	//get the buttons whose unit mask is "*", or which are available for the unit type or its class, in definition order
+	static const std::vector<button *> &get_unit_type_buttons(const unit_type *unit_type);
+
+	//get the buttons whose unit mask is "*" or contains the identifier (e.g. "cancel-build"), in definition order
+	static const std::vector<button *> &get_unit_mask_buttons(const std::string &identifier);
+
+	static bool compare_definition_order(const button *lhs, const button *rhs)
+	{
+		return lhs->definition_order < rhs->definition_order;
+	}
+
+	//to be called whenever a button's unit mask or unit classes change
+	static void clear_unit_button_cache();
+
 private:
+	static void update_unit_button_cache();
+
 	static inline size_t faction_button_count = 0;
 
+	//the unit mask of each button resolved once, so that the button panel doesn't need to search the unit mask strings
+	static inline bool unit_button_cache_valid = false;
+	static inline size_t unit_button_cache_button_count = 0;
+	static inline std::map<std::string, std::vector<button *>> unit_mask_buttons;
+	static inline std::vector<button *> any_unit_buttons;
+	static inline unit_type_map<std::vector<button *>> unit_type_buttons;
+
 public:
 	explicit button(const std::string &identifier = "");
 	~button();
@@ -164,6 +188,16 @@ public:
 		return this->unit_classes;
 	}
 
+	bool is_available_for_any_unit() const
+	{
+		return this->UnitMask[0] == '*';
+	}
+
+	bool has_unit_mask_identifier(const std::string &identifier) const;
+
+	//whether the unit type is in the button's unit mask or its class is in the button's unit classes; doesn't count the "*" unit mask
+	bool is_available_for_unit_type(const unit_type *unit_type) const;
+
 	bool has_position_based_hotkey() const;
 
 	bool is_usable_when_paused() const;
@@ -189,6 +223,8 @@ public:
 	std::string UnitMask;       //for which units is it available
 private:
 	std::vector<unit_class *> unit_classes; //unit classes for which the button is available
+	std::vector<std::string> unit_mask_identifiers; //the identifiers in the unit mask, sorted; set when the unit button cache is updated
+	size_t definition_order = 0;
 public:
 	IconConfig Icon;      		/// icon to display
 	int Key = 0;                    /// alternative on keyboard
@@ -487,7 +487,7 @@ bool ButtonCheckHasInventory(const CUnit &unit, const wyrmgus::button &button)
 */
 bool ButtonCheckHasSubButtons(const CUnit &unit, const wyrmgus::button &button)
 {
-	for (const wyrmgus::button *other_button : wyrmgus::button::get_all()) {
+	for (const wyrmgus::button *other_button : wyrmgus::button::get_unit_type_buttons(unit.Type)) {
 		if (other_button->GetLevelID() != button.Value) {
 			continue;
 		}
@@ -495,12 +495,6 @@ bool ButtonCheckHasSubButtons(const CUnit &unit, const wyrmgus::button &button)
 		if (other_button->Action == ButtonCmd::Button && (other_button->Value == button.GetLevelID() || other_button->Value == 0)) { //don't count buttons to return to the level where this button is, or buttons to return to the default level
 			continue;
 		}
-
-		std::array<char, 128> unit_ident{};
-		sprintf(unit_ident.data(), ",%s,", unit.Type->get_identifier().c_str());
-		if (other_button->UnitMask[0] != '*' && !strstr(other_button->UnitMask.c_str(), unit_ident.data()) && !wyrmgus::vector::contains(other_button->get_unit_classes(), unit.Type->get_unit_class())) {
-			continue;
-		}
 		
 		if (!other_button->is_always_shown() && !IsButtonAllowed(unit, *other_button)) {
 			continue;
@@ -916,6 +916,7 @@ int CclDefineButton(lua_State *l)
 			if (!strncmp(button->UnitMask.c_str(), ",*,", 3)) {
 				button->UnitMask = "*";
 			}
+			button::clear_unit_button_cache();
 		} else {
 			LuaError(l, "Unsupported tag: %s" _C_ value);
 		}
@@ -441,7 +441,7 @@ int CclUnit(lua_State *l)
 			CclGetPos(l, &unit->Seen.tilePos.x , &unit->Seen.tilePos.y, -1);
 			lua_pop(l, 1);
 		} else if (!strcmp(value, "stats")) {
-			unit->Stats = &type->Stats[LuaToNumber(l, 2, j + 1)];
+			unit->Stats = type->Stats.get_unit_stats_pointer(LuaToNumber(l, 2, j + 1));
 		} else if (!strcmp(value, "pixel")) {
 			lua_rawgeti(l, 2, j + 1);
 			Vec2i pixel_offset;
@@ -3405,7 +3405,7 @@ void CUnit::AssignToPlayer(CPlayer &player)
 {
 	const wyrmgus::unit_type &type = *Type;
 
-	this->Stats = &type.Stats[player.get_index()];
+	this->Stats = type.Stats.get_unit_stats_pointer(player.get_index());
 
 	if (!SaveGameLoading) {
 		if (UnitTypeVar.GetNumberVariable()) {
@@ -5331,6 +5331,11 @@ void UnitCountSeen(CUnit &unit)
 					break;
 				}
 				UnitGoesOutOfFog(unit, *CPlayer::Players[p]);
+
+				//decode the unit's sounds in the background, so that they don't have to be decoded when first played
+				if (CPlayer::Players[p].get() == CPlayer::GetThisPlayer() && unit.Type->get_sound_set() != nullptr) {
+					unit.Type->get_sound_set()->prefetch_sounds();
+				}
 			}
 			if (oldv[p] && !newv) {
 				UnitGoesUnderFog(unit, *CPlayer::Players[p]);
@@ -5542,7 +5547,7 @@ void CUnit::ChangeOwner(CPlayer &newplayer, bool show_change)
 
 	MapUnmarkUnitSight(*this);
 	newplayer.AddUnit(*this);
-	Stats = &Type->Stats[newplayer.get_index()];
+	Stats = Type->Stats.get_unit_stats_pointer(newplayer.get_index());
 
 	//  Must change food/gold and other.
 	//Wyrmgus start
@@ -6114,22 +6119,37 @@ void CUnit::SetIndividualUpgrade(const CUpgrade *upgrade, int quantity)
 		return;
 	}
 	
+	const auto find_iterator = std::lower_bound(this->IndividualUpgrades.begin(), this->IndividualUpgrades.end(), upgrade->ID, [](const std::pair<int, int> &individual_upgrade, const int upgrade_id) {
+		return individual_upgrade.first < upgrade_id;
+	});
+	const bool found = find_iterator != this->IndividualUpgrades.end() && find_iterator->first == upgrade->ID;
+
 	if (quantity <= 0) {
-		if (this->IndividualUpgrades.find(upgrade->ID) != this->IndividualUpgrades.end()) {
-			this->IndividualUpgrades.erase(upgrade->ID);
+		if (found) {
+			this->IndividualUpgrades.erase(find_iterator);
 		}
+	} else if (found) {
+		find_iterator->second = quantity;
 	} else {
-		this->IndividualUpgrades[upgrade->ID] = quantity;
+		this->IndividualUpgrades.insert(find_iterator, std::make_pair(upgrade->ID, quantity));
 	}
 }
 
 int CUnit::GetIndividualUpgrade(const CUpgrade *upgrade) const
 {
-	if (upgrade && this->IndividualUpgrades.find(upgrade->ID) != this->IndividualUpgrades.end()) {
-		return this->IndividualUpgrades.find(upgrade->ID)->second;
-	} else {
+	if (upgrade == nullptr) {
 		return 0;
 	}
+
+	const auto find_iterator = std::lower_bound(this->IndividualUpgrades.begin(), this->IndividualUpgrades.end(), upgrade->ID, [](const std::pair<int, int> &individual_upgrade, const int upgrade_id) {
+		return individual_upgrade.first < upgrade_id;
+	});
+
+	if (find_iterator != this->IndividualUpgrades.end() && find_iterator->first == upgrade->ID) {
+		return find_iterator->second;
+	}
+
+	return 0;
 }
 
 int CUnit::GetAvailableLevelUpUpgrades(bool only_units) const
@@ -844,7 +844,7 @@ public:
 
 	bool has_status_effect(const status_effect status_effect) const
 	{
-		return this->status_effect_timers.contains(status_effect);
+		return this->get_status_effect_timer(status_effect) > 0;
 	}
 
 	void apply_status_effect(const status_effect status_effect, const int cycles)
@@ -857,16 +857,17 @@ public:
 		this->set_status_effect_timer(status_effect, 0);
 	}
 
-	const std::map<status_effect, int> &get_status_effect_timers() const
+	const std::vector<std::pair<status_effect, int>> &get_status_effect_timers() const
 	{
 		return this->status_effect_timers;
 	}
 
 	int get_status_effect_timer(const status_effect status_effect) const
 	{
-		const auto find_iterator = this->status_effect_timers.find(status_effect);
-		if (find_iterator != this->status_effect_timers.end()) {
-			return find_iterator->second;
+		for (const auto &[timer_status_effect, cycles] : this->status_effect_timers) {
+			if (timer_status_effect == status_effect) {
+				return cycles;
+			}
 		}
 
 		return 0;
@@ -874,12 +875,20 @@ public:
 
 	void set_status_effect_timer(const status_effect status_effect, const int cycles)
 	{
+		//kept sorted by status effect, so that the order in which they are saved is deterministic
+		const auto find_iterator = std::lower_bound(this->status_effect_timers.begin(), this->status_effect_timers.end(), status_effect, [](const std::pair<wyrmgus::status_effect, int> &timer, const wyrmgus::status_effect status_effect) {
+			return timer.first < status_effect;
+		});
+		const bool found = find_iterator != this->status_effect_timers.end() && find_iterator->first == status_effect;
+
 		if (cycles <= 0) {
-			if (this->status_effect_timers.contains(status_effect)) {
-				this->status_effect_timers.erase(status_effect);
+			if (found) {
+				this->status_effect_timers.erase(find_iterator);
 			}
+		} else if (found) {
+			find_iterator->second = cycles;
 		} else {
-			this->status_effect_timers[status_effect] = cycles;
+			this->status_effect_timers.insert(find_iterator, std::make_pair(status_effect, cycles));
 		}
 	}
 
@@ -889,19 +898,13 @@ public:
 			return;
 		}
 
-		std::vector<status_effect> effects_to_remove;
-
-		for (auto &[status_effect, cycles] : this->status_effect_timers) {
-			--cycles;
-
-			if (cycles <= 0) {
-				effects_to_remove.push_back(status_effect);
-			}
+		for (std::pair<status_effect, int> &timer : this->status_effect_timers) {
+			--timer.second;
 		}
 
-		for (const status_effect status_effect : effects_to_remove) {
-			this->status_effect_timers.erase(status_effect);
-		}
+		std::erase_if(this->status_effect_timers, [](const std::pair<status_effect, int> &timer) {
+			return timer.second <= 0;
+		});
 	}
 
 	bool IsItemEquipped(const CUnit *item) const;
@@ -1088,7 +1091,7 @@ public:
 	CUnit *ConnectingDestination;	/// Which connector this unit connects to (if any)
 	std::map<ButtonCmd, const wyrmgus::icon *> ButtonIcons;				/// icons for button actions
 	//Wyrmgus end
-	std::map<int, int> IndividualUpgrades;      /// individual upgrades which the unit has (and how many of it the unit has)
+	std::vector<std::pair<int, int>> IndividualUpgrades; /// individual upgrades which the unit has (and how many of it the unit has), sorted by upgrade ID
 private:
 	std::vector<const CUpgrade *> bonus_abilities;
 
@@ -1176,7 +1179,7 @@ public:
 private:
 	std::vector<const wyrmgus::spell *> autocast_spells; //the list of autocast spells
 	spell_map<int> spell_cooldown_timers; //how many cycles the unit needs to wait before spell will be ready
-	std::map<status_effect, int> status_effect_timers; //how many cycles need to pass until a status effect wears off
+	std::vector<std::pair<status_effect, int>> status_effect_timers; //how many cycles need to pass until a status effect wears off, sorted by status effect
 
 public:
 	CUnit *Goal; /// Generic/Teleporter goal pointer
@@ -34,6 +34,7 @@
 
 #include "unit/unit_cache.h"
 
+#include "economy/resource_source_index.h"
 #include "map/map.h"
 #include "map/map_info.h"
 #include "map/map_layer.h"
@@ -62,6 +63,8 @@ CUnit *CUnitCache::Remove(const unsigned int index)
 void CMap::Insert(CUnit &unit)
 {
 	assert_throw(!unit.Removed);
+	unit.MapLayer->get_resource_source_index()->add_unit(&unit);
+
 	unsigned int index = unit.Offset;
 	const int w = unit.Type->get_tile_width();
 	const int h = unit.Type->get_tile_height();
@@ -86,6 +89,8 @@ void CMap::Insert(CUnit &unit)
 void CMap::Remove(CUnit &unit)
 {
 	assert_throw(!unit.Removed);
+	unit.MapLayer->get_resource_source_index()->remove_unit(&unit);
+
 	unsigned int index = unit.Offset;
 	const int w = unit.Type->get_tile_width();
 	const int h = unit.Type->get_tile_height();
@@ -39,12 +39,21 @@
 
 namespace wyrmgus {
 
+struct unit_manager::unit_block final
+{
+	alignas(CUnit) std::byte data[sizeof(CUnit) * unit_manager::unit_block_size];
+};
+
 unit_manager::unit_manager()
 {
 }
 
 unit_manager::~unit_manager()
 {
+	//the references to units seen under fog have to be destroyed before the units themselves
+	this->units_seen_under_fog.clear();
+
+	this->destroy_slot_units();
 }
 
 /**
@@ -55,7 +64,7 @@ void unit_manager::init()
 	this->lastCreated = nullptr;
 	this->units.clear();
 	this->released_units.clear();
-	this->unit_slots.clear();
+	this->destroy_slot_units();
 }
 
 void unit_manager::clean_units()
@@ -125,12 +134,7 @@ CUnit *unit_manager::AllocUnit()
 		unit->UnitManagerData.unitSlot = -1;
 		return unit;
 	} else {
-		auto unit = std::make_unique<CUnit>();
-		unit->UnitManagerData.slot = this->unit_slots.size();
-		CUnit *unit_ptr = unit.get();
-		this->unit_slots.push_back(std::move(unit));
-
-		return unit_ptr;
+		return this->create_slot_unit();
 	}
 }
 
@@ -172,12 +176,16 @@ void unit_manager::ReleaseUnit(CUnit *unit)
 
 CUnit &unit_manager::GetSlotUnit(const int index) const
 {
-	return *this->unit_slots.at(index);
+	if (index < 0 || static_cast<size_t>(index) >= this->unit_slot_count) {
+		throw std::runtime_error("Invalid unit slot: " + std::to_string(index) + ".");
+	}
+
+	return *this->get_slot_unit(index);
 }
 
 unsigned int unit_manager::GetUsedSlotCount() const
 {
-	return static_cast<unsigned int>(this->unit_slots.size());
+	return static_cast<unsigned int>(this->unit_slot_count);
 }
 
 bool unit_manager::empty() const
@@ -204,7 +212,7 @@ void unit_manager::Add(CUnit *unit)
 */
 void unit_manager::Save(CFile &file) const
 {
-	file.printf("SlotUsage(%lu, {", (long unsigned int)this->unit_slots.size());
+	file.printf("SlotUsage(%lu, {", (long unsigned int)this->unit_slot_count);
 
 	for (const CUnit *unit : this->released_units) {
 		file.printf("{Slot = %d, FreeCycle = %u}, ", UnitNumber(*unit), unit->ReleaseCycle);
@@ -242,9 +250,7 @@ void unit_manager::Load(lua_State *l)
 		LuaError(l, "incorrect argument");
 	}
 	for (unsigned int i = 0; i < unitCount; i++) {
-		auto unit = std::make_unique<CUnit>();
-		unit->UnitManagerData.slot = i;
-		this->unit_slots.push_back(std::move(unit));
+		this->create_slot_unit();
 	}
 
 	const unsigned int args = lua_rawlen(l, 2);
@@ -265,14 +271,17 @@ void unit_manager::Load(lua_State *l)
 			}
 		}
 		assert_throw(unit_index != -1 && cycle != static_cast<unsigned long>(-1));
-		this->unit_slots[unit_index]->Destroyed = 1;
-		this->ReleaseUnit(this->unit_slots[unit_index].get());
-		this->unit_slots[unit_index]->ReleaseCycle = cycle;
+		CUnit &unit = this->GetSlotUnit(unit_index);
+		unit.Destroyed = 1;
+		this->ReleaseUnit(&unit);
+		unit.ReleaseCycle = cycle;
 		lua_pop(l, 1);
 	}
 
 	//initialize the base reference for all non-destroyed units
-	for (const std::unique_ptr<CUnit> &unit : this->unit_slots) {
+	for (size_t i = 0; i < this->unit_slot_count; ++i) {
+		CUnit *unit = this->get_slot_unit(i);
+
 		if (unit->Destroyed) {
 			continue;
 		}
@@ -281,6 +290,40 @@ void unit_manager::Load(lua_State *l)
 	}
 }
 
+CUnit *unit_manager::create_slot_unit()
+{
+	const size_t slot = this->unit_slot_count;
+	const size_t block_index = slot / unit_manager::unit_block_size;
+
+	if (block_index >= this->unit_blocks.size()) {
+		//default-initialize the block, as its storage is only used when units are constructed in it
+		this->unit_blocks.push_back(std::unique_ptr<unit_block>(new unit_block));
+	}
+
+	std::byte *storage = this->unit_blocks[block_index]->data + (slot % unit_manager::unit_block_size) * sizeof(CUnit);
+	CUnit *unit = new (storage) CUnit;
+	unit->UnitManagerData.slot = static_cast<int>(slot);
+	++this->unit_slot_count;
+
+	return unit;
+}
+
+CUnit *unit_manager::get_slot_unit(const size_t slot) const
+{
+	std::byte *storage = this->unit_blocks[slot / unit_manager::unit_block_size]->data + (slot % unit_manager::unit_block_size) * sizeof(CUnit);
+	return std::launder(reinterpret_cast<CUnit *>(storage));
+}
+
+void unit_manager::destroy_slot_units()
+{
+	for (size_t i = 0; i < this->unit_slot_count; ++i) {
+		std::destroy_at(this->get_slot_unit(i));
+	}
+
+	this->unit_slot_count = 0;
+	this->unit_blocks.clear();
+}
+
 void unit_manager::add_unit_seen_under_fog(CUnit *unit)
 {
 	this->units_seen_under_fog[unit] = unit->acquire_ref();
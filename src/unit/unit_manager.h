@@ -70,11 +70,22 @@ public:
 	void remove_unit_seen_under_fog(CUnit *unit);
 
 private:
+	struct unit_block;
+
+	//the amount of unit slots stored contiguously in each block
+	static constexpr size_t unit_block_size = 64;
+
+	CUnit *create_slot_unit();
+	CUnit *get_slot_unit(const size_t slot) const;
+	void destroy_slot_units();
+
 	//units currently in use
 	std::vector<CUnit *> units;
 
-	//all units, including released ones; the unit's index here is its slot
-	std::vector<std::unique_ptr<CUnit>> unit_slots;
+	//all units, including released ones, stored in fixed-size blocks; a unit's slot is its index across the blocks
+	//units in adjacent slots are thus adjacent in memory, and unit addresses remain stable when more blocks are allocated
+	std::vector<std::unique_ptr<unit_block>> unit_blocks;
+	size_t unit_slot_count = 0;
 
 	std::list<CUnit *> released_units;
 	CUnit *lastCreated = nullptr;
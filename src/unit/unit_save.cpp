@@ -457,7 +457,7 @@ void SaveUnit(const CUnit &unit, CFile &file)
 		}
 	}
 
-	for (std::map<int, int>::const_iterator iterator = unit.IndividualUpgrades.begin(); iterator != unit.IndividualUpgrades.end(); ++iterator) {
+	for (std::vector<std::pair<int, int>>::const_iterator iterator = unit.IndividualUpgrades.begin(); iterator != unit.IndividualUpgrades.end(); ++iterator) {
 		int upgrade_id = iterator->first;
 		CUpgrade *upgrade = CUpgrade::get_all()[upgrade_id];
 		
@@ -358,9 +358,10 @@
 **    Movement mask, this value is and'ed to the map field flags, to
 **    see if a unit can enter or placed on the map field.
 **
-**  unit_type::Stats[::PlayerMax]
+**  unit_type::Stats
 **
-**    Unit status for each player
+**    Unit status for each player, players without upgrades affecting
+**    the unit type share unit_type::DefaultStat
 **  @todo This stats should? be moved into the player struct
 **
 **  unit_type::Type
@@ -647,7 +648,8 @@ unit_type::unit_type(const std::string &identifier) : detailed_data_entry(identi
 	domain(unit_domain::land),
 	can_target_flags(can_target_flag::none),
 	FieldFlags(tile_flag::none),
-	MovementMask(tile_flag::none)
+	MovementMask(tile_flag::none),
+	Stats(&this->DefaultStat)
 {
 	memset(MissileOffsets, 0, sizeof(MissileOffsets));
 
@@ -1128,7 +1130,9 @@ void unit_type::initialize()
 	}
 
 	if (!CclInConfigFile || GameRunning || CEditor::get()->is_running()) {
-		UpdateUnitStats(*this, 1);
+		//the default stats may have changed, so the players' copies made from them are outdated as well, even if not modified
+		this->Stats.reset_all_to_default();
+		UpdateUnitStats(*this, 0);
 	}
 
 	if (CEditor::get()->is_running() && std::find(CEditor::get()->UnitTypes.begin(), CEditor::get()->UnitTypes.end(), this->get_identifier()) == CEditor::get()->UnitTypes.end()) {
@@ -1886,6 +1890,8 @@ void unit_type::RemoveButtons(const ButtonCmd button_action)
 			button::get_all()[i]->UnitMask = FindAndReplaceString(button::get_all()[i]->UnitMask, this->get_identifier() + ",", "");
 		}
 	}
+
+	button::clear_unit_button_cache();
 }
 
 int unit_type::GetAvailableLevelUpUpgrades() const
@@ -2731,9 +2737,8 @@ void resource_info::process_gsml_scope(const gsml_data &scope)
 void UpdateUnitStats(wyrmgus::unit_type &type, int reset)
 {
 	if (reset) {
-		for (int player = 0; player < PlayerMax; ++player) {
-			type.Stats[player] = type.DefaultStat;
-		}
+		//players without their own copy of the stats already use the default stats, and only the copies modified since the last reset need to be recalculated
+		type.Stats.reset_to_default();
 	}
 
 	//as a side effect we calculate the movement flags/mask here
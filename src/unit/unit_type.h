@@ -36,6 +36,7 @@
 #include "unit/group_selection_mode.h"
 #include "unit/image_layer.h"
 #include "unit/unit_stats.h"
+#include "unit/unit_type_stats.h"
 #include "util/color_container.h"
 #include "vec2i.h"
 
@@ -1327,7 +1328,7 @@ public:
 	tile_flag MovementMask;          /// Unit check this map flags for move
 
 	/// @todo This stats should? be moved into the player struct
-	unit_stats Stats[PlayerMax];     /// Unit status for each player
+	unit_type_stats Stats;     /// Unit status for each player
 
 	std::shared_ptr<CPlayerColorGraphic> Sprite;     /// Sprite images
 	std::shared_ptr<CGraphic> ShadowSprite;          /// Shadow sprite image
@@ -0,0 +1,87 @@
+//       _________ __                 __
+//      /   _____//  |_____________ _/  |______     ____  __ __  ______
+//      \_____  \\   __\_  __ \__  \\   __\__  \   / ___\|  |  \/  ___/
+//      /        \|  |  |  | \// __ \|  |  / __ \_/ /_/  >  |  /\___ |
+//     /_______  /|__|  |__|  (____  /__| (____  /\___  /|____//____  >
+//             \/                  \/          \//_____/            \/
+//  ______________________                           ______________________
+//                        T H E   W A R   B E G I N S
+//         Stratagus - A free fantasy real time strategy game engine
+//
+//      (c) Copyright 2026 by Andrettin
+//
+//      This program is free software; you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation; only version 2 of the License.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program; if not, write to the Free Software
+//      Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+//      02111-1307, USA.
+
+#include "stratagus.h"
+
+#include "unit/unit_type_stats.h"
+
+#include "unit/unit_stats.h"
+#include "util/assert_util.h"
+
+namespace wyrmgus {
+
+unit_type_stats::unit_type_stats(const unit_stats *default_stats) : default_stats(default_stats)
+{
+}
+
+unit_type_stats::~unit_type_stats()
+{
+}
+
+void unit_type_stats::reset_to_default()
+{
+	for (size_t player = 0; player < this->player_stats.size(); ++player) {
+		if (!this->modified_players[player]) {
+			//the copy was only created for units to point to, and still has the default values
+			continue;
+		}
+
+		*this->player_stats[player] = *this->default_stats;
+	}
+
+	this->modified_players.fill(false);
+}
+
+void unit_type_stats::reset_all_to_default()
+{
+	for (const std::unique_ptr<unit_stats> &stats : this->player_stats) {
+		if (stats != nullptr) {
+			*stats = *this->default_stats;
+		}
+	}
+
+	this->modified_players.fill(false);
+}
+
+unit_stats &unit_type_stats::get_or_create_player_stats(const int player) const
+{
+	assert_throw(player >= 0 && player < PlayerMax);
+
+	if (player >= static_cast<int>(this->player_stats.size())) {
+		this->player_stats.resize(player + 1);
+	}
+
+	std::unique_ptr<unit_stats> &stats = this->player_stats[player];
+
+	if (stats == nullptr) {
+		stats = std::make_unique<unit_stats>();
+		*stats = *this->default_stats;
+	}
+
+	return *stats;
+}
+
+}
@@ -0,0 +1,101 @@
+//       _________ __                 __
+//      /   _____//  |_____________ _/  |______     ____  __ __  ______
+//      \_____  \\   __\_  __ \__  \\   __\__  \   / ___\|  |  \/  ___/
+//      /        \|  |  |  | \// __ \|  |  / __ \_/ /_/  >  |  /\___ |
+//     /_______  /|__|  |__|  (____  /__| (____  /\___  /|____//____  >
+//             \/                  \/          \//_____/            \/
+//  ______________________                           ______________________
+//                        T H E   W A R   B E G I N S
+//         Stratagus - A free fantasy real time strategy game engine
+//
+//      (c) Copyright 2026 by Andrettin
+//
+//      This program is free software; you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation; only version 2 of the License.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program; if not, write to the Free Software
+//      Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+//      02111-1307, USA.
+
+#pragma once
+
+namespace wyrmgus {
+
+class unit_stats;
+
+//the stats of a unit type for each player
+//a player only gets its own copy of the stats once they are modified for it (e.g. by an upgrade) or referenced by one of its units; until then, the unit type's default stats are shared
+class unit_type_stats final
+{
+public:
+	explicit unit_type_stats(const unit_stats *default_stats);
+	~unit_type_stats();
+
+	unit_type_stats(const unit_type_stats &other) = delete;
+	unit_type_stats &operator =(const unit_type_stats &other) = delete;
+
+	const unit_stats &operator [](const int player) const
+	{
+		const unit_stats *stats = this->get_player_stats(player);
+
+		if (stats != nullptr) {
+			return *stats;
+		}
+
+		return *this->default_stats;
+	}
+
+	//get the player's own copy of the stats, for modification
+	unit_stats &operator [](const int player)
+	{
+		unit_stats &stats = this->get_or_create_player_stats(player);
+		this->modified_players[player] = true;
+		return stats;
+	}
+
+	//get the player's own copy of the stats, for units to keep a pointer to; the pointer remains valid when the player's stats are modified later on
+	const unit_stats *get_unit_stats_pointer(const int player) const
+	{
+		return &this->get_or_create_player_stats(player);
+	}
+
+	bool has_player_stats(const int player) const
+	{
+		return this->get_player_stats(player) != nullptr;
+	}
+
+	//reset the players' copies of the stats which have been modified since the last reset to the default stats; this is done in place, as units may be pointing to them
+	void reset_to_default();
+
+	//reset all the players' copies of the stats to the default stats, needed if the default stats themselves changed
+	void reset_all_to_default();
+
+private:
+	const unit_stats *get_player_stats(const int player) const
+	{
+		if (player >= static_cast<int>(this->player_stats.size())) {
+			return nullptr;
+		}
+
+		return this->player_stats[player].get();
+	}
+
+	unit_stats &get_or_create_player_stats(const int player) const;
+
+	const unit_stats *default_stats = nullptr;
+
+	//indexed by player, only as large as the highest player index which has its own copy of the stats
+	mutable std::vector<std::unique_ptr<unit_stats>> player_stats;
+
+	//the players whose copy of the stats may differ from the default stats, as it was accessed for modification since the last reset
+	std::array<bool, PlayerMax> modified_players{};
+};
+
+}
@@ -276,10 +276,8 @@ void upgrade_modifier::apply_to_player(CPlayer *player, const int multiplier) co
 			continue;
 		}
 
-		unit_stats &stat = unit_type->Stats[player_index];
-
 		//Wyrmgus start
-		if (stat.Variables.empty()) {
+		if (std::as_const(unit_type->Stats)[player_index].Variables.empty()) {
 			//unit type's stats not initialized
 			break;
 		}
@@ -293,6 +291,9 @@ void upgrade_modifier::apply_to_player(CPlayer *player, const int multiplier) co
 			continue;
 		}
 
+		//only the unit types which are actually modified get their own copy of the stats for the player
+		unit_stats &stat = unit_type->Stats[player_index];
+
 		std::vector<CUnit *> unitupgrade;
 		FindPlayerUnitsByType(*player, *unit_type, unitupgrade);
 
@@ -0,0 +1,78 @@
+//       _________ __                 __
+//      /   _____//  |_____________ _/  |______     ____  __ __  ______
+//      \_____  \\   __\_  __ \__  \\   __\__  \   / ___\|  |  \/  ___/
+//      /        \|  |  |  | \// __ \|  |  / __ \_/ /_/  >  |  /\___ |
+//     /_______  /|__|  |__|  (____  /__| (____  /\___  /|____//____  >
+//             \/                  \/          \//_____/            \/
+//  ______________________                           ______________________
+//                        T H E   W A R   B E G I N S
+//         Stratagus - A free fantasy real time strategy game engine
+//
+//      (c) Copyright 2026 by Andrettin
+//
+//      This program is free software; you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation; only version 2 of the License.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program; if not, write to the Free Software
+//      Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+//      02111-1307, USA.
+
+#include "stratagus.h"
+
+#include "util/allocation_counter.h"
+
+#ifdef USE_ALLOCATION_COUNTING
+
+#include <new>
+
+//counters for the replaced global operator new, used to report the allocations made by each startup stage; relaxed atomics are used since only the totals matter, not their order relative to other memory operations
+static std::atomic<uint64_t> allocation_count = 0;
+static std::atomic<uint64_t> allocated_bytes = 0;
+
+void *operator new(const size_t size)
+{
+	allocation_count.fetch_add(1, std::memory_order_relaxed);
+	allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+
+	//the default operator new cannot return a null pointer for a zero-sized allocation
+	void *ptr = std::malloc(size != 0 ? size : 1);
+
+	if (ptr == nullptr) {
+		throw std::bad_alloc();
+	}
+
+	return ptr;
+}
+
+void operator delete(void *ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+	std::free(ptr);
+}
+
+namespace wyrmgus {
+
+uint64_t get_allocation_count()
+{
+	return allocation_count.load(std::memory_order_relaxed);
+}
+
+uint64_t get_allocated_bytes()
+{
+	return allocated_bytes.load(std::memory_order_relaxed);
+}
+
+}
+
+#endif
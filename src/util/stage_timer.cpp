@@ -0,0 +1,75 @@
+//       _________ __                 __
+//      /   _____//  |_____________ _/  |______     ____  __ __  ______
+//      \_____  \\   __\_  __ \__  \\   __\__  \   / ___\|  |  \/  ___/
+//      /        \|  |  |  | \// __ \|  |  / __ \_/ /_/  >  |  /\___ |
+//     /_______  /|__|  |__|  (____  /__| (____  /\___  /|____//____  >
+//             \/                  \/          \//_____/            \/
+//  ______________________                           ______________________
+//                        T H E   W A R   B E G I N S
+//         Stratagus - A free fantasy real time strategy game engine
+//
+//      (c) Copyright 2026 by Andrettin
+//
+//      This program is free software; you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation; only version 2 of the License.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program; if not, write to the Free Software
+//      Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+//      02111-1307, USA.
+
+#include "stratagus.h"
+
+#include "util/stage_timer.h"
+
+#include "util/allocation_counter.h"
+
+namespace wyrmgus {
+
+void stage_timer::restart()
+{
+	this->start_time = std::chrono::steady_clock::now();
+
+#ifdef USE_ALLOCATION_COUNTING
+	this->start_allocation_count = get_allocation_count();
+	this->start_allocated_bytes = get_allocated_bytes();
+#endif
+}
+
+long long stage_timer::get_elapsed_ms() const
+{
+	return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - this->start_time).count();
+}
+
+void stage_timer::print(const std::string &stage_name) const
+{
+	//the stage timings are diagnostic output, like debug prints
+	if (!EnableDebugPrint) {
+		return;
+	}
+
+	fprintf(stdout, "%s: %lld ms.\n", stage_name.c_str(), this->get_elapsed_ms());
+}
+
+void stage_timer::print_with_allocations(const std::string &stage_name) const
+{
+#ifdef USE_ALLOCATION_COUNTING
+	if (!EnableDebugPrint) {
+		return;
+	}
+
+	const unsigned long long allocation_count = get_allocation_count() - this->start_allocation_count;
+	const unsigned long long allocated_kb = (get_allocated_bytes() - this->start_allocated_bytes) / 1024;
+	fprintf(stdout, "%s: %lld ms, %llu allocations (%llu KB).\n", stage_name.c_str(), this->get_elapsed_ms(), allocation_count, allocated_kb);
+#else
+	this->print(stage_name);
+#endif
+}
+
+}
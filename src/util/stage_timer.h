@@ -0,0 +1,58 @@
+//       _________ __                 __
+//      /   _____//  |_____________ _/  |______     ____  __ __  ______
+//      \_____  \\   __\_  __ \__  \\   __\__  \   / ___\|  |  \/  ___/
+//      /        \|  |  |  | \// __ \|  |  / __ \_/ /_/  >  |  /\___ |
+//     /_______  /|__|  |__|  (____  /__| (____  /\___  /|____//____  >
+//             \/                  \/          \//_____/            \/
+//  ______________________                           ______________________
+//                        T H E   W A R   B E G I N S
+//         Stratagus - A free fantasy real time strategy game engine
+//
+//      (c) Copyright 2026 by Andrettin
+//
+//      This program is free software; you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation; only version 2 of the License.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program; if not, write to the Free Software
+//      Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+//      02111-1307, USA.
+
+#pragma once
+
+namespace wyrmgus {
+
+//measures the wall-clock time and heap allocations of a stage of work since its construction or last restart, for printing them to stdout if debug printing is enabled
+class stage_timer final
+{
+public:
+	stage_timer()
+	{
+		this->restart();
+	}
+
+	void restart();
+
+	long long get_elapsed_ms() const;
+
+	//print "<stage name>: <elapsed> ms."
+	void print(const std::string &stage_name) const;
+
+	//print the elapsed time together with the number and total size of the allocations made during the stage, or only the elapsed time if allocation counting is disabled
+	void print_with_allocations(const std::string &stage_name) const;
+
+private:
+	std::chrono::steady_clock::time_point start_time;
+#ifdef USE_ALLOCATION_COUNTING
+	uint64_t start_allocation_count = 0;
+	uint64_t start_allocated_bytes = 0;
+#endif
+};
+
+}
@@ -70,20 +70,19 @@ void font::drawString(gcn::Graphics *graphics, const std::string &txt, int x, in
 }
 
 /**
-**  Draw character with current color.
+**  Add a character's rect to a glyph run.
 **
-**  @param g   Pointer to object
-**  @param gx  X offset into object
-**  @param gy  Y offset into object
-**  @param w   width to display
-**  @param h   height to display
-**  @param x   X screen position
-**  @param y   Y screen position
+**  @param gx           X offset into object
+**  @param gy           Y offset into object
+**  @param w            width to display
+**  @param h            height to display
+**  @param x            X screen position
+**  @param y            Y screen position
+**  @param glyph_rects  Glyph run to which the rect is added
 */
-static void VideoDrawChar(CGraphic &g,
-						  int gx, int gy, int w, int h, int x, int y, std::vector<std::function<void(renderer *)>> &render_commands)
+static void VideoDrawChar(int gx, int gy, int w, int h, int x, int y, std::vector<std::pair<QRect, QPoint>> &glyph_rects)
 {
-	g.DrawSub(gx, gy, w, h, x, y, render_commands);
+	glyph_rects.emplace_back(QRect(gx, gy, w, h), QPoint(x, y));
 }
 
 /**
@@ -185,6 +184,11 @@ int font::Width(const std::string &text)
 		this->load();
 	}
 
+	const auto find_iterator = this->text_widths.find(text);
+	if (find_iterator != this->text_widths.end()) {
+		return find_iterator->second;
+	}
+
 	int width = 0;
 	bool isformat = false;
 	int utf8;
@@ -221,6 +225,14 @@ int font::Width(const std::string &text)
 			width += this->char_width[utf8 - 32] + 1;
 		}
 	}
+
+	//text which changes every frame (e.g. timers) would otherwise make the cache grow indefinitely
+	if (this->text_widths.size() >= font::max_cached_text_widths) {
+		this->text_widths.clear();
+	}
+
+	this->text_widths[text] = width;
+
 	return width;
 }
 
@@ -258,31 +270,30 @@ font::~font()
 }
 
 /**
-**  Draw character with current color clipped into 8 bit framebuffer.
+**  Add a character's rect to a glyph run, clipped to the current clipping rectangle.
 **
-**  @param g   Pointer to object
-**  @param gx  X offset into object
-**  @param gy  Y offset into object
-**  @param w   width to display
-**  @param h   height to display
-**  @param x   X screen position
-**  @param y   Y screen position
+**  @param gx           X offset into object
+**  @param gy           Y offset into object
+**  @param w            width to display
+**  @param h            height to display
+**  @param x            X screen position
+**  @param y            Y screen position
+**  @param glyph_rects  Glyph run to which the rect is added
 */
-static void VideoDrawCharClip(CGraphic &g, int gx, int gy, int w, int h,
-							  int x, int y, std::vector<std::function<void(renderer *)>> &render_commands)
+static void VideoDrawCharClip(int gx, int gy, int w, int h, int x, int y, std::vector<std::pair<QRect, QPoint>> &glyph_rects)
 {
 	int ox;
 	int oy;
 	int ex;
 	CLIP_RECTANGLE_OFS(x, y, w, h, ox, oy, ex);
 	Q_UNUSED(ex);
-	VideoDrawChar(g, gx + ox, gy + oy, w, h, x, y, render_commands);
+	VideoDrawChar(gx + ox, gy + oy, w, h, x, y, glyph_rects);
 }
 
 namespace wyrmgus {
 
 template<bool CLIP>
-unsigned int font::DrawChar(CGraphic &g, int utf8, int x, int y, std::vector<std::function<void(renderer *)>> &render_commands) const
+unsigned int font::DrawChar(int utf8, int x, int y, std::vector<std::pair<QRect, QPoint>> &glyph_rects) const
 {
 	int c = utf8 - 32;
 	assert_throw(c >= 0);
@@ -296,9 +307,9 @@ unsigned int font::DrawChar(CGraphic &g, int utf8, int x, int y, std::vector<std
 	const int gy = (c / ipr) * this->G->Height;
 
 	if constexpr (CLIP) {
-		VideoDrawCharClip(g, gx, gy, w, this->G->Height, x , y, render_commands);
+		VideoDrawCharClip(gx, gy, w, this->G->Height, x , y, glyph_rects);
 	} else {
-		VideoDrawChar(g, gx, gy, w, this->G->Height, x, y, render_commands);
+		VideoDrawChar(gx, gy, w, this->G->Height, x, y, glyph_rects);
 	}
 	return w + 1;
 }
@@ -353,6 +364,20 @@ int CLabel::DoDrawText(int x, int y, const std::string &text, const font_color *
 	CGraphic *g = this->font->get_font_color_graphic(fc);
 	//Wyrmgus end
 
+	//glyphs are batched into a single render command for each run of the same color
+	std::vector<std::pair<QRect, QPoint>> glyph_rects;
+	glyph_rects.reserve(text.size());
+
+	const auto set_color = [&](const font_color *new_fc) {
+		CGraphic *new_g = this->font->get_font_color_graphic(new_fc);
+		if (new_g != g) {
+			g->render_rects(std::move(glyph_rects), render_commands);
+			glyph_rects.clear();
+			g = new_g;
+		}
+		fc = new_fc;
+	};
+
 	while (GetUTF8(text, pos, utf8)) {
 		tab = false;
 
@@ -364,6 +389,7 @@ int CLabel::DoDrawText(int x, int y, const std::string &text, const font_color *
 			switch (text[pos]) {
 				case '\0':  // wrong formatted string.
 					DebugPrint("oops, format your ~\n");
+					g->render_rects(std::move(glyph_rects), render_commands);
 					return widths;
 				case '~':
 					++pos;
@@ -373,8 +399,7 @@ int CLabel::DoDrawText(int x, int y, const std::string &text, const font_color *
 					continue;
 				case '!':
 					if (fc != reverse) {
-						fc = reverse;
-						g = font->get_font_color_graphic(fc);
+						set_color(reverse);
 					}
 					++pos;
 					continue;
@@ -382,16 +407,16 @@ int CLabel::DoDrawText(int x, int y, const std::string &text, const font_color *
 					LastTextColor = fc;
 					if (fc != reverse) {
 						isColor = true;
-						fc = reverse;
-						g = font->get_font_color_graphic(fc);
+						set_color(reverse);
 					}
 					++pos;
 					continue;
 				case '>':
 					if (fc != LastTextColor) {
-						std::swap(fc, LastTextColor);
+						const font_color *last_fc = LastTextColor;
+						LastTextColor = fc;
 						isColor = false;
-						g = font->get_font_color_graphic(fc);
+						set_color(last_fc);
 					}
 					++pos;
 					continue;
@@ -403,6 +428,7 @@ int CLabel::DoDrawText(int x, int y, const std::string &text, const font_color *
 					}
 					if (!*p) {
 						DebugPrint("oops, format your ~\n");
+						g->render_rects(std::move(glyph_rects), render_commands);
 						return widths;
 					}
 					std::string color;
@@ -413,8 +439,7 @@ int CLabel::DoDrawText(int x, int y, const std::string &text, const font_color *
 					const font_color *fc_tmp = font_color::get(color);
 					if (fc_tmp) {
 						isColor = true;
-						fc = fc_tmp;
-						g = font->get_font_color_graphic(fc);
+						set_color(fc_tmp);
 					}
 
 					continue;
@@ -424,17 +449,18 @@ int CLabel::DoDrawText(int x, int y, const std::string &text, const font_color *
 
 		if (tab) {
 			for (int tabs = 0; tabs < tabSize; ++tabs) {
-				widths += font->DrawChar<CLIP>(*g, ' ', x + widths, y, render_commands);
+				widths += font->DrawChar<CLIP>(' ', x + widths, y, glyph_rects);
 			}
 		} else {
-			widths += font->DrawChar<CLIP>(*g, utf8, x + widths, y, render_commands);
+			widths += font->DrawChar<CLIP>(utf8, x + widths, y, glyph_rects);
 		}
 
 		if (isColor == false && fc != backup) {
-			fc = backup;
-			g = font->get_font_color_graphic(fc);
+			set_color(backup);
 		}
 	}
+
+	g->render_rects(std::move(glyph_rects), render_commands);
 	return widths;
 }
 
@@ -575,27 +601,27 @@ static int strchrlen(const std::string &s, char c, unsigned int maxlen, wyrmgus:
 }
 
 /**
-**  Return the 'line' line of the string 's'.
+**  Split a string into lines.
 **
-**  @param line    line number.
 **  @param s       multiline string.
-**  @param maxlen  max length of the string (0 : unlimited) (in char if font == null else in pixels).
+**  @param maxlen  max length of a line (0 : unlimited) (in char if font == null else in pixels).
 **  @param font    if specified use font->Width() instead of strlen.
 **
-**  @return computed value.
+**  @return the lines of the string.
 */
-std::string GetLineFont(unsigned int line, const std::string &s, unsigned int maxlen, wyrmgus::font *font)
+static std::vector<std::string> wrap_lines(const std::string &s, unsigned int maxlen, wyrmgus::font *font)
 {
-	unsigned int res;
+	std::vector<std::string> lines;
 	std::string s1 = s;
 
-	assert_throw(0 < line);
+	while (true) {
+		const unsigned int res = strchrlen(s1, '\n', maxlen, font);
+		lines.push_back(s1.substr(0, res));
 
-	for (unsigned int i = 1; i < line; ++i) {
-		res = strchrlen(s1, '\n', maxlen, font);
 		if (!res || res >= s1.size()) {
-			return "";
+			break;
 		}
+
 		//Wyrmgus start
 //		s1 = s1.substr(res + 1);
 		if (s1.substr(res, 1).find(' ') != std::string::npos || s1.substr(res, 1).find('\n') != std::string::npos) {
@@ -605,12 +631,54 @@ std::string GetLineFont(unsigned int line, const std::string &s, unsigned int ma
 		}
 		//Wyrmgus end
 	}
-	res = strchrlen(s1, '\n', maxlen, font);
-	return s1.substr(0, res);
+
+	return lines;
+}
+
+/**
+**  Return the 'line' line of the string 's'.
+**
+**  @param line    line number.
+**  @param s       multiline string.
+**  @param maxlen  max length of the string (0 : unlimited) (in char if font == null else in pixels).
+**  @param font    if specified use font->Width() instead of strlen.
+**
+**  @return computed value.
+*/
+std::string GetLineFont(unsigned int line, const std::string &s, unsigned int maxlen, wyrmgus::font *font)
+{
+	assert_throw(0 < line);
+
+	if (font == nullptr) {
+		const std::vector<std::string> lines = wrap_lines(s, maxlen, nullptr);
+		return line <= lines.size() ? lines[line - 1] : std::string();
+	}
+
+	//the lines are requested one by one, so they are wrapped once and cached by the font, rather than wrapping the preceding lines again for each of them
+	const std::vector<std::string> &lines = font->get_wrapped_lines(s, maxlen);
+	return line <= lines.size() ? lines[line - 1] : std::string();
 }
 
 namespace wyrmgus {
 
+const std::vector<std::string> &font::get_wrapped_lines(const std::string &text, const unsigned int max_width)
+{
+	const std::pair<unsigned int, std::string> key(max_width, text);
+
+	const auto find_iterator = this->wrapped_lines.find(key);
+	if (find_iterator != this->wrapped_lines.end()) {
+		return find_iterator->second;
+	}
+
+	if (this->wrapped_lines.size() >= font::max_cached_text_widths) {
+		this->wrapped_lines.clear();
+	}
+
+	std::vector<std::string> lines = wrap_lines(text, max_width, this);
+
+	return this->wrapped_lines[key] = std::move(lines);
+}
+
 /**
 **  Calculate the width of each character
 */
@@ -719,6 +787,8 @@ void font::load()
 
 	this->G->Load(preferences::get()->get_scale_factor());
 	this->MeasureWidths();
+	this->text_widths.clear();
+	this->wrapped_lines.clear();
 }
 
 void font::free_textures(std::vector<std::function<void()>> &render_commands)
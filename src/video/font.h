@@ -48,6 +48,7 @@ public:
 	static constexpr const char *class_identifier = "font";
 	static constexpr const char property_class_identifier[] = "wyrmgus::font*";
 	static constexpr const char *database_folder = "fonts";
+	static constexpr size_t max_cached_text_widths = 4096;
 
 	//this function is kept since it is still used in tolua++
 	static font *Get(const std::string &identifier)
@@ -70,6 +71,9 @@ public:
 	int Width(const std::string &text);
 	int Width(const int number);
 
+	//get the lines of the text, wrapped to the given maximum width in pixels (0 for unlimited)
+	const std::vector<std::string> &get_wrapped_lines(const std::string &text, const unsigned int max_width);
+
 	virtual int getHeight() override { return Height(); }
 	virtual int getWidth(const std::string &text) override { return Width(text); }
 	//Wyrmgus start
@@ -80,7 +84,7 @@ public:
 	CGraphic *get_font_color_graphic(const wyrmgus::font_color *font_color);
 
 	template<bool CLIP>
-	unsigned int DrawChar(CGraphic &g, int utf8, int x, int y, std::vector<std::function<void(renderer *)>> &render_commands) const;
+	unsigned int DrawChar(int utf8, int x, int y, std::vector<std::pair<QRect, QPoint>> &glyph_rects) const;
 
 	void free_textures(std::vector<std::function<void()>> &render_commands);
 	void unload_graphics();
@@ -93,6 +97,8 @@ private:
 	std::filesystem::path filepath;
 	QSize size;
 	std::vector<char> char_width; //real font width (starting with ' ')
+	std::unordered_map<std::string, int> text_widths; //cached widths of measured strings
+	std::map<std::pair<unsigned int, std::string>, std::vector<std::string>> wrapped_lines; //cached line wrapping of strings, keyed by the maximum width
 	std::shared_ptr<CGraphic> G; /// Graphic object used to draw
 	std::map<const font_color *, std::shared_ptr<CGraphic>> font_color_graphics;
 };
@@ -861,6 +861,19 @@ void CGraphic::render_rect(const QRect &rect, const QPoint &pixel_pos, const col
 	});
 }
 
+void CGraphic::render_rects(std::vector<std::pair<QRect, QPoint>> &&rects, std::vector<std::function<void(renderer *)>> &render_commands)
+{
+	if (rects.empty()) {
+		return;
+	}
+
+	render_commands.push_back([this, rects = std::move(rects)](renderer *renderer) {
+		const QOpenGLTexture *texture = this->get_or_create_texture(color_modification(), false);
+
+		renderer->blit_texture_rects(texture, rects);
+	});
+}
+
 void CGraphic::free_textures()
 {
 	this->texture.reset();
@@ -82,13 +82,23 @@ void render_context::run(renderer *renderer)
 
 void render_context::set_free_texture_commands(std::vector<std::function<void()>> &&commands)
 {
-	std::lock_guard<std::mutex> lock(this->mutex);
-	this->free_texture_commands = std::move(commands);
+	std::lock_guard<std::mutex> lock(this->free_texture_mutex);
+
+	//append rather than replace, so that textures queued individually for freeing are not lost
+	for (std::function<void()> &command : commands) {
+		this->free_texture_commands.push_back(std::move(command));
+	}
+}
+
+void render_context::add_free_texture_command(std::function<void()> &&command)
+{
+	std::lock_guard<std::mutex> lock(this->free_texture_mutex);
+	this->free_texture_commands.push_back(std::move(command));
 }
 
 void render_context::run_free_texture_commands()
 {
-	std::lock_guard<std::mutex> lock(this->mutex);
+	std::lock_guard<std::mutex> lock(this->free_texture_mutex);
 	for (const std::function<void()> &command : this->free_texture_commands) {
 		command();
 	}
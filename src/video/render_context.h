@@ -41,12 +41,14 @@ public:
 	void run(renderer *renderer);
 
 	void set_free_texture_commands(std::vector<std::function<void()>> &&commands);
+	void add_free_texture_command(std::function<void()> &&command);
 	void run_free_texture_commands();
 
 private:
 	std::vector<std::function<void(renderer *)>> commands;
 	std::vector<std::function<void()>> free_texture_commands;
 	std::mutex mutex;
+	std::mutex free_texture_mutex; //separate from the command mutex, so that textures can be queued for freeing while render commands are being replaced
 };
 
 }
@@ -166,6 +166,45 @@ void renderer::blit_texture_frame(const QOpenGLTexture *texture, const QPoint &p
 	this->blit_texture_frame(texture, pos, frame_pixel_pos, frame_size, flip, opacity, show_percent, frame_size);
 }
 
+void renderer::blit_texture_rects(const QOpenGLTexture *texture, const std::vector<std::pair<QRect, QPoint>> &rects)
+{
+	this->painter->beginNativePainting();
+	this->setup_native_opengl_state();
+
+	const double texture_width = texture->width();
+	const double texture_height = texture->height();
+
+	glBindTexture(GL_TEXTURE_2D, texture->textureId());
+
+	glBegin(GL_QUADS);
+
+	for (const auto &[source_rect, pos] : rects) {
+		const QPoint mirrored_pos = this->get_mirrored_pos(pos, source_rect.size());
+		const QPoint end_pos = mirrored_pos + QPoint(source_rect.width(), source_rect.height());
+
+		const double source_left = source_rect.x() / texture_width;
+		const double source_right = (source_rect.x() + source_rect.width()) / texture_width;
+		const double source_top = source_rect.y() / texture_height;
+		const double source_bottom = (source_rect.y() + source_rect.height()) / texture_height;
+
+		//the target is mirrored vertically, so the upper edge of the quad shows the bottom of the source rect
+		glTexCoord2d(source_left, source_bottom);
+		glVertex2i(mirrored_pos.x(), mirrored_pos.y());
+		glTexCoord2d(source_right, source_bottom);
+		glVertex2i(end_pos.x(), mirrored_pos.y());
+		glTexCoord2d(source_right, source_top);
+		glVertex2i(end_pos.x(), end_pos.y());
+		glTexCoord2d(source_left, source_top);
+		glVertex2i(mirrored_pos.x(), end_pos.y());
+	}
+
+	glEnd();
+
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	this->painter->endNativePainting();
+}
+
 void renderer::draw_image(const QImage &image, const QPoint &pos)
 {
 	this->painter->drawImage(pos, image);
@@ -93,6 +93,9 @@ public:
 		this->blit_texture_frame(texture, pos, QPoint(0, 0), size, flip, opacity, 100, rendered_size);
 	}
 
+	//blit several source rects of a texture, each to its own position, in a single draw call
+	void blit_texture_rects(const QOpenGLTexture *texture, const std::vector<std::pair<QRect, QPoint>> &rects);
+
 	void draw_image(const QImage &image, const QPoint &pos);
 
 	void draw_pixel(const QPoint &pos, const QColor &color);
@@ -373,6 +373,9 @@ public:
 
 	void render_rect(const QRect &rect, const QPoint &pixel_pos, const color_modification &color_modification, const bool grayscale, const unsigned char opacity, std::vector<std::function<void(renderer *)>> &render_commands);
 
+	//render several source rects of the graphic in a single render command
+	void render_rects(std::vector<std::pair<QRect, QPoint>> &&rects, std::vector<std::function<void(renderer *)>> &render_commands);
+
 	bool has_textures() const
 	{
 		return this->texture != nullptr || this->grayscale_texture != nullptr || !this->modified_textures.empty();
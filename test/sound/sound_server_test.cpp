@@ -0,0 +1,57 @@
+//       _________ __                 __
+//      /   _____//  |_____________ _/  |______     ____  __ __  ______
+//      \_____  \\   __\_  __ \__  \\   __\__  \   / ___\|  |  \/  ___/
+//      /        \|  |  |  | \// __ \|  |  / __ \_/ /_/  >  |  /\___ |
+//     /_______  /|__|  |__|  (____  /__| (____  /\___  /|____//____  >
+//             \/                  \/          \//_____/            \/
+//  ______________________                           ______________________
+//                        T H E   W A R   B E G I N S
+//         Stratagus - A free fantasy real time strategy game engine
+//
+//      (c) Copyright 2026 by Andrettin
+//
+//      This program is free software; you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation; only version 2 of the License.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program; if not, write to the Free Software
+//      Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+//      02111-1307, USA.
+
+#include "stratagus.h"
+
+#include "sound/sound_server.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_CASE(merged_sample_volume_test)
+{
+    BOOST_CHECK(GetMergedSampleVolume(100, 100) == 150);
+    BOOST_CHECK(GetMergedSampleVolume(40, 100) == 120);
+    BOOST_CHECK(GetMergedSampleVolume(200, 200) == MaxVolume);
+}
+
+BOOST_AUTO_TEST_CASE(voice_to_stop_test)
+{
+    const std::vector<sound_voice> voices = {
+        sound_voice{ 0, sound_priority::voice, 100 },
+        sound_voice{ 1, sound_priority::effect, 50 },
+        sound_voice{ 2, sound_priority::effect, 200 }
+    };
+
+    //the voice with the lowest priority and volume is stopped for a more important sample
+    BOOST_CHECK(ChooseVoiceToStop(voices, 100, sound_priority::effect) == 1);
+    BOOST_CHECK(ChooseVoiceToStop(voices, 10, sound_priority::ui) == 1);
+
+    //a sample which is not more important than any voice is dropped
+    BOOST_CHECK(ChooseVoiceToStop(voices, 50, sound_priority::effect) == -1);
+    BOOST_CHECK(ChooseVoiceToStop(voices, 40, sound_priority::effect) == -1);
+
+    BOOST_CHECK(ChooseVoiceToStop({}, 100, sound_priority::ui) == -1);
+}
@@ -0,0 +1,146 @@
+//       _________ __                 __
+//      /   _____//  |_____________ _/  |______     ____  __ __  ______
+//      \_____  \\   __\_  __ \__  \\   __\__  \   / ___\|  |  \/  ___/
+//      /        \|  |  |  | \// __ \|  |  / __ \_/ /_/  >  |  /\___ |
+//     /_______  /|__|  |__|  (____  /__| (____  /\___  /|____//____  >
+//             \/                  \/          \//_____/            \/
+//  ______________________                           ______________________
+//                        T H E   W A R   B E G I N S
+//         Stratagus - A free fantasy real time strategy game engine
+//
+//      (c) Copyright 2026 by Andrettin
+//
+//      This program is free software; you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation; only version 2 of the License.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program; if not, write to the Free Software
+//      Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+//      02111-1307, USA.
+
+#include "stratagus.h"
+
+#include "database/gsml_binary.h"
+
+#include "database/gsml_data.h"
+#include "database/gsml_operator.h"
+#include "database/gsml_property.h"
+#include "util/path_util.h"
+#include "util/string_util.h"
+
+#include <boost/test/unit_test.hpp>
+
+#pragma warning(push, 0)
+#include <QDataStream>
+#include <QFile>
+#pragma warning(pop)
+
+static std::string describe_gsml_data(const gsml_data &data)
+{
+	std::string str = data.get_tag() + " " + std::to_string(static_cast<int>(data.get_operator())) + " {";
+
+	for (const std::string &value : data.get_values()) {
+		str += " " + value;
+	}
+
+	data.for_each_element([&](const gsml_property &property) {
+		str += " " + property.get_key() + " " + std::to_string(static_cast<int>(property.get_operator())) + " " + property.get_value();
+	}, [&](const gsml_data &child_scope) {
+		str += " " + describe_gsml_data(child_scope);
+	});
+
+	str += " }";
+	return str;
+}
+
+static void write_raw_gsml_binary_file(const std::filesystem::path &filepath, const quint32 string_count, const quint8 operator_value)
+{
+	QFile file(path::to_qstring(filepath));
+	BOOST_REQUIRE(file.open(QIODevice::WriteOnly));
+
+	QDataStream stream(&file);
+	stream.setVersion(QDataStream::Qt_6_0);
+
+	//header: magic and version
+	stream << static_cast<quint32>(0x57475342) << static_cast<quint32>(2);
+
+	stream << string_count;
+	stream << QByteArray("root");
+
+	//root scope: tag index, operator, value count, element count
+	stream << static_cast<quint32>(0) << operator_value << static_cast<quint32>(0) << static_cast<quint32>(0);
+}
+
+BOOST_AUTO_TEST_CASE(gsml_binary_round_trip_test)
+{
+	gsml_data data("root", gsml_operator::assignment);
+	data.add_property("name", gsml_operator::assignment, "Test");
+
+	gsml_data unit_scope("unit", gsml_operator::assignment);
+	unit_scope.add_property("name", gsml_operator::assignment, "Test");
+	unit_scope.add_property("hit_points", gsml_operator::addition, "10");
+
+	gsml_data condition_scope("level", gsml_operator::greater_than_or_equality);
+	condition_scope.add_value("2");
+	condition_scope.add_value("Test");
+	unit_scope.add_child(std::move(condition_scope));
+
+	data.add_child(std::move(unit_scope));
+	data.add_child(gsml_data("empty", gsml_operator::subtraction));
+
+	const std::filesystem::path filepath = std::filesystem::temp_directory_path() / "gsml_binary_round_trip_test.gsmlb";
+	write_gsml_binary_file(data, filepath);
+
+	const gsml_data read_data = read_gsml_binary_file(filepath);
+	std::filesystem::remove(filepath);
+
+	BOOST_CHECK_EQUAL(describe_gsml_data(read_data), describe_gsml_data(data));
+}
+
+BOOST_AUTO_TEST_CASE(gsml_binary_quoted_value_test)
+{
+	//values written for the text format are quoted and escaped, and must be read back as the text parser would read them
+	const std::string name = "Test \"Map\"\nSecond Line\\";
+
+	gsml_data data("root", gsml_operator::assignment);
+	data.add_property("name", gsml_operator::assignment, "\"" + string::escaped(name) + "\"");
+
+	gsml_data values_scope("values", gsml_operator::assignment);
+	values_scope.add_value("\"" + string::escaped(name) + "\"");
+	data.add_child(std::move(values_scope));
+
+	const std::filesystem::path filepath = std::filesystem::temp_directory_path() / "gsml_binary_quoted_value_test.gsmlb";
+	write_gsml_binary_file(data, filepath);
+
+	const gsml_data read_data = read_gsml_binary_file(filepath);
+	std::filesystem::remove(filepath);
+
+	BOOST_CHECK_EQUAL(read_data.get_property_value("name"), name);
+	BOOST_REQUIRE_EQUAL(read_data.get_child("values").get_values().size(), 1u);
+	BOOST_CHECK_EQUAL(read_data.get_child("values").get_values().front(), name);
+}
+
+BOOST_AUTO_TEST_CASE(gsml_binary_invalid_operator_test)
+{
+	const std::filesystem::path filepath = std::filesystem::temp_directory_path() / "gsml_binary_invalid_operator_test.gsmlb";
+	write_raw_gsml_binary_file(filepath, 1, std::numeric_limits<quint8>::max());
+
+	BOOST_CHECK_THROW(read_gsml_binary_file(filepath), std::runtime_error);
+	std::filesystem::remove(filepath);
+}
+
+BOOST_AUTO_TEST_CASE(gsml_binary_invalid_string_count_test)
+{
+	//a string count larger than the file could hold must fail instead of reserving or reading that many strings
+	const std::filesystem::path filepath = std::filesystem::temp_directory_path() / "gsml_binary_invalid_string_count_test.gsmlb";
+	write_raw_gsml_binary_file(filepath, std::numeric_limits<quint32>::max(), static_cast<quint8>(gsml_operator::assignment));
+
+	BOOST_CHECK_THROW(read_gsml_binary_file(filepath), std::runtime_error);
+	std::filesystem::remove(filepath);
+}